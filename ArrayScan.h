@@ -0,0 +1,316 @@
+// ArrayScan.h
+// Linear scans used by the array-based DSs (ArrayBag, ArraySortedList, ...).
+// For int, long long, float and double (and other signed 32/64-bit integers) they compare
+// a whole AVX2 vector per step when the CPU has AVX2; otherwise they are plain loops.
+#ifndef _ARRAY_SCAN_H_
+#define _ARRAY_SCAN_H_
+#include <functional>
+#include <type_traits>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DS_ARRAY_SCAN_AVX2
+#include <immintrin.h>
+#define DS_AVX2_TARGET __attribute__((target("avx2,popcnt")))
+#endif
+using namespace std;
+
+// Number of items equal to target
+template<class ItemType>
+int arrayCountEqual(const ItemType* items, int n, const ItemType& target);
+
+// Index of the first item equal to target, or -1
+template<class ItemType>
+int arrayIndexOf(const ItemType* items, int n, const ItemType& target);
+
+// For items sorted from SMALL to BIG: number of items smaller than target
+// (that is, the index where target is or would be inserted)
+template<class ItemType>
+int arrayCountLess(const ItemType* items, int n, const ItemType& target);
+
+// For items sorted from BIG to SMALL: number of items bigger than target
+template<class ItemType>
+int arrayCountGreater(const ItemType* items, int n, const ItemType& target);
+
+// For items sorted by comp: number of items comp puts before target
+// (less<ItemType> and greater<ItemType> go to the two functions above)
+template<class ItemType, class Compare>
+int arrayCountBefore(const ItemType* items, int n, const ItemType& target, Compare comp);
+
+enum ArrayScanOp { SCAN_EQUAL, SCAN_LESS, SCAN_GREATER };
+
+//=================================================================================================
+// Scalar kernels (any ItemType)
+//=================================================================================================
+template<int OP, class ItemType>
+inline bool scanMatches(const ItemType& item, const ItemType& target)
+{
+	if (OP == SCAN_EQUAL)
+		return (item == target);
+	else if (OP == SCAN_LESS)
+		return (item < target);
+	else
+		return (item > target);
+}
+
+template<int OP, class ItemType>
+int scalarCount(const ItemType* items, int n, const ItemType& target)
+{
+	int count = 0;
+	if (OP == SCAN_EQUAL)
+	{
+		for (int i = 0; i < n; i++)
+		{
+			if (items[i] == target)
+				count++;
+		}
+	}
+	else // sorted: stop at the first item that does not match
+	{
+		while (count < n && scanMatches<OP>(items[count], target))
+			count++;
+	}
+	return count;
+}
+
+template<class ItemType>
+int scalarIndexOf(const ItemType* items, int n, const ItemType& target)
+{
+	for (int i = 0; i < n; i++) {
+		if (items[i] == target)
+			return i;
+	}
+	return -1;
+}
+
+#ifdef DS_ARRAY_SCAN_AVX2
+//=================================================================================================
+// AVX2 kernels
+//=================================================================================================
+// Each lane type wraps the intrinsics of one element type;
+// mask() gives one bit per lane.
+struct Avx2Int32Lanes
+{
+	typedef int Scalar;
+	typedef __m256i Vec;
+	static const int LANES = 8;
+	DS_AVX2_TARGET static Vec set1(Scalar x) { return _mm256_set1_epi32(x); }
+	DS_AVX2_TARGET static Vec load(const Scalar* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	DS_AVX2_TARGET static Vec equal(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+	DS_AVX2_TARGET static Vec less(Vec a, Vec b) { return _mm256_cmpgt_epi32(b, a); }
+	DS_AVX2_TARGET static Vec greater(Vec a, Vec b) { return _mm256_cmpgt_epi32(a, b); }
+	DS_AVX2_TARGET static int mask(Vec v) { return _mm256_movemask_ps(_mm256_castsi256_ps(v)); }
+};
+
+struct Avx2Int64Lanes
+{
+	typedef long long Scalar;
+	typedef __m256i Vec;
+	static const int LANES = 4;
+	DS_AVX2_TARGET static Vec set1(Scalar x) { return _mm256_set1_epi64x(x); }
+	DS_AVX2_TARGET static Vec load(const Scalar* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	DS_AVX2_TARGET static Vec equal(Vec a, Vec b) { return _mm256_cmpeq_epi64(a, b); }
+	DS_AVX2_TARGET static Vec less(Vec a, Vec b) { return _mm256_cmpgt_epi64(b, a); }
+	DS_AVX2_TARGET static Vec greater(Vec a, Vec b) { return _mm256_cmpgt_epi64(a, b); }
+	DS_AVX2_TARGET static int mask(Vec v) { return _mm256_movemask_pd(_mm256_castsi256_pd(v)); }
+};
+
+struct Avx2FloatLanes
+{
+	typedef float Scalar;
+	typedef __m256 Vec;
+	static const int LANES = 8;
+	DS_AVX2_TARGET static Vec set1(Scalar x) { return _mm256_set1_ps(x); }
+	DS_AVX2_TARGET static Vec load(const Scalar* p) { return _mm256_loadu_ps(p); }
+	DS_AVX2_TARGET static Vec equal(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+	DS_AVX2_TARGET static Vec less(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	DS_AVX2_TARGET static Vec greater(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	DS_AVX2_TARGET static int mask(Vec v) { return _mm256_movemask_ps(v); }
+};
+
+struct Avx2DoubleLanes
+{
+	typedef double Scalar;
+	typedef __m256d Vec;
+	static const int LANES = 4;
+	DS_AVX2_TARGET static Vec set1(Scalar x) { return _mm256_set1_pd(x); }
+	DS_AVX2_TARGET static Vec load(const Scalar* p) { return _mm256_loadu_pd(p); }
+	DS_AVX2_TARGET static Vec equal(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+	DS_AVX2_TARGET static Vec less(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+	DS_AVX2_TARGET static Vec greater(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+	DS_AVX2_TARGET static int mask(Vec v) { return _mm256_movemask_pd(v); }
+};
+
+template<int OP, class Lanes>
+DS_AVX2_TARGET inline typename Lanes::Vec avx2Compare(typename Lanes::Vec a, typename Lanes::Vec b)
+{
+	if (OP == SCAN_EQUAL)
+		return Lanes::equal(a, b);
+	else if (OP == SCAN_LESS)
+		return Lanes::less(a, b);
+	else
+		return Lanes::greater(a, b);
+}
+
+// SCAN_EQUAL is branch-free: compare a vector, popcount the mask.
+// SCAN_LESS and SCAN_GREATER scan sorted items, so like scalarCount they stop at the first
+// vector that is not all matches: its leading matches are the last ones counted.
+template<int OP, class Lanes>
+DS_AVX2_TARGET int avx2Count(const typename Lanes::Scalar* items, int n, typename Lanes::Scalar target)
+{
+	const int ALL_LANES = (1 << Lanes::LANES) - 1;
+	typename Lanes::Vec targetVec = Lanes::set1(target);
+	int count = 0;
+	int i = 0;
+	for (; i + Lanes::LANES <= n; i += Lanes::LANES)
+	{
+		int mask = Lanes::mask(avx2Compare<OP, Lanes>(Lanes::load(items + i), targetVec));
+		if (OP == SCAN_EQUAL)
+			count += __builtin_popcount(mask);
+		else if (mask != ALL_LANES)
+			return count + __builtin_ctz(~mask); // matches before the first lane that fails
+		else
+			count += Lanes::LANES;
+	}
+	return count + scalarCount<OP>(items + i, n - i, target); // the tail
+}
+
+template<class Lanes>
+DS_AVX2_TARGET int avx2IndexOf(const typename Lanes::Scalar* items, int n, typename Lanes::Scalar target)
+{
+	typename Lanes::Vec targetVec = Lanes::set1(target);
+	int i = 0;
+	for (; i + Lanes::LANES <= n; i += Lanes::LANES)
+	{
+		int mask = Lanes::mask(Lanes::equal(Lanes::load(items + i), targetVec));
+		if (mask != 0)
+			return i + __builtin_ctz(mask);
+	}
+	for (; i < n; i++) // the tail
+	{
+		if (items[i] == target)
+			return i;
+	}
+	return -1;
+}
+
+inline bool cpuHasAvx2()
+{
+	static const bool hasAvx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+	return hasAvx2;
+}
+
+// Picks the lane type of ItemType at compile time; void means "no vector kernel"
+template<class ItemType, class Enable = void>
+struct Avx2LanesOf
+{
+	typedef void type;
+};
+
+template<class ItemType>
+struct Avx2LanesOf<ItemType, typename enable_if<is_integral<ItemType>::value && is_signed<ItemType>::value
+											   && sizeof(ItemType) == 4>::type>
+{
+	typedef Avx2Int32Lanes type;
+};
+
+template<class ItemType>
+struct Avx2LanesOf<ItemType, typename enable_if<is_integral<ItemType>::value && is_signed<ItemType>::value
+											   && sizeof(ItemType) == 8>::type>
+{
+	typedef Avx2Int64Lanes type;
+};
+
+template<>
+struct Avx2LanesOf<float>
+{
+	typedef Avx2FloatLanes type;
+};
+
+template<>
+struct Avx2LanesOf<double>
+{
+	typedef Avx2DoubleLanes type;
+};
+
+template<int OP, class ItemType, class Lanes>
+int dispatchCount(const ItemType* items, int n, const ItemType& target, Lanes*)
+{
+	if (cpuHasAvx2())
+		return avx2Count<OP, Lanes>(reinterpret_cast<const typename Lanes::Scalar*>(items), n, target);
+	return scalarCount<OP>(items, n, target);
+}
+
+template<class ItemType, class Lanes>
+int dispatchIndexOf(const ItemType* items, int n, const ItemType& target, Lanes*)
+{
+	if (cpuHasAvx2())
+		return avx2IndexOf<Lanes>(reinterpret_cast<const typename Lanes::Scalar*>(items), n, target);
+	return scalarIndexOf(items, n, target);
+}
+#else
+template<class ItemType>
+struct Avx2LanesOf
+{
+	typedef void type;
+};
+#endif // DS_ARRAY_SCAN_AVX2
+
+template<int OP, class ItemType>
+int dispatchCount(const ItemType* items, int n, const ItemType& target, void*)
+{
+	return scalarCount<OP>(items, n, target);
+}
+
+template<class ItemType>
+int dispatchIndexOf(const ItemType* items, int n, const ItemType& target, void*)
+{
+	return scalarIndexOf(items, n, target);
+}
+
+//=================================================================================================
+// Entry points
+//=================================================================================================
+template<class ItemType>
+int arrayCountEqual(const ItemType* items, int n, const ItemType& target)
+{
+	return dispatchCount<SCAN_EQUAL>(items, n, target, static_cast<typename Avx2LanesOf<ItemType>::type*>(nullptr));
+}
+
+template<class ItemType>
+int arrayIndexOf(const ItemType* items, int n, const ItemType& target)
+{
+	return dispatchIndexOf(items, n, target, static_cast<typename Avx2LanesOf<ItemType>::type*>(nullptr));
+}
+
+template<class ItemType>
+int arrayCountLess(const ItemType* items, int n, const ItemType& target)
+{
+	return dispatchCount<SCAN_LESS>(items, n, target, static_cast<typename Avx2LanesOf<ItemType>::type*>(nullptr));
+}
+
+template<class ItemType>
+int arrayCountGreater(const ItemType* items, int n, const ItemType& target)
+{
+	return dispatchCount<SCAN_GREATER>(items, n, target, static_cast<typename Avx2LanesOf<ItemType>::type*>(nullptr));
+}
+
+template<class ItemType, class Compare>
+int arrayCountBefore(const ItemType* items, int n, const ItemType& target, Compare comp)
+{
+	int count = 0;
+	while (count < n && comp(items[count], target))
+		count++;
+	return count;
+}
+
+template<class ItemType>
+int arrayCountBefore(const ItemType* items, int n, const ItemType& target, less<ItemType>)
+{
+	return arrayCountLess(items, n, target);
+}
+
+template<class ItemType>
+int arrayCountBefore(const ItemType* items, int n, const ItemType& target, greater<ItemType>)
+{
+	return arrayCountGreater(items, n, target);
+}
+#endif // !_ARRAY_SCAN_H_
@@ -0,0 +1,162 @@
+// ArrayStorage.h
+// Raw item storage for the array-based DSs (ArrayBag, ArrayList, ArrayStack, ...).
+// Slots are only constructed when an item is put in them, so unused capacity costs nothing
+// and ItemType does not need a default constructor.
+// Trivially copyable items are grown with realloc; others are moved one by one.
+#ifndef _ARRAY_STORAGE_H_
+#define _ARRAY_STORAGE_H_
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Uninitialized room for capacity items (nullptr when capacity is 0)
+template<class ItemType>
+ItemType* allocateItems(int capacity)
+{
+	if (capacity <= 0)
+		return nullptr;
+	void* storage = std::malloc(capacity * sizeof(ItemType));
+	if (storage == nullptr)
+		throw std::bad_alloc();
+	return static_cast<ItemType*>(storage);
+}
+
+// Releases the storage; the items in it must have been destroyed already
+template<class ItemType>
+void freeItems(ItemType* items)
+{
+	std::free(items);
+}
+
+// Like allocateItems, but items[0] starts on an alignment-byte boundary (a power of 2).
+// Must be released with freeAlignedItems.
+template<class ItemType>
+ItemType* allocateAlignedItems(int capacity, int alignment)
+{
+	if (capacity <= 0)
+		return nullptr;
+	// the items, the slack to align them, and in front of them the pointer free() needs
+	void* storage = std::malloc(capacity * sizeof(ItemType) + alignment + sizeof(void*));
+	if (storage == nullptr)
+		throw std::bad_alloc();
+	std::uintptr_t first = reinterpret_cast<std::uintptr_t>(storage) + sizeof(void*);
+	std::uintptr_t aligned = (first + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+	reinterpret_cast<void**>(aligned)[-1] = storage;
+	return reinterpret_cast<ItemType*>(aligned);
+}
+
+template<class ItemType>
+void freeAlignedItems(ItemType* items)
+{
+	if (items != nullptr)
+		std::free(reinterpret_cast<void**>(items)[-1]);
+}
+
+// Destroys items[first .. last - 1]
+template<class ItemType>
+void destroyItems(ItemType* items, int first, int last)
+{
+	if (!std::is_trivially_destructible<ItemType>::value)
+	{
+		for (int i = first; i < last; i++)
+			items[i].~ItemType();
+	}
+}
+
+// Copy-constructs count items into the uninitialized dest
+template<class ItemType>
+void copyItems(ItemType* dest, const ItemType* src, int count)
+{
+	if (std::is_trivially_copyable<ItemType>::value)
+	{
+		if (count > 0)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(ItemType));
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+			new (&dest[i]) ItemType(src[i]);
+	}
+}
+
+// Moves count items into the uninitialized dest; src is left uninitialized
+template<class ItemType>
+void relocateItems(ItemType* dest, ItemType* src, int count)
+{
+	if (std::is_trivially_copyable<ItemType>::value)
+	{
+		if (count > 0)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), count * sizeof(ItemType));
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+		{
+			new (&dest[i]) ItemType(std::move(src[i]));
+			src[i].~ItemType();
+		}
+	}
+}
+
+// Trivially copyable items: realloc may grow the block in place
+template<class ItemType>
+ItemType* reallocateItems(ItemType* items, int, int newCapacity, std::true_type)
+{
+	void* storage = std::realloc(static_cast<void*>(items), newCapacity * sizeof(ItemType));
+	if (storage == nullptr)
+		throw std::bad_alloc();
+	return static_cast<ItemType*>(storage);
+}
+
+// Other items: moved one by one into new storage
+template<class ItemType>
+ItemType* reallocateItems(ItemType* items, int count, int newCapacity, std::false_type)
+{
+	ItemType* newItems = allocateItems<ItemType>(newCapacity);
+	relocateItems(newItems, items, count);
+	freeItems(items);
+	return newItems;
+}
+
+// Moves the first count items of items into new storage of newCapacity
+// (count <= newCapacity) and returns it; the old storage is released.
+template<class ItemType>
+ItemType* reallocateItems(ItemType* items, int count, int newCapacity)
+{
+	if (newCapacity <= 0)
+	{
+		freeItems(items);
+		return nullptr;
+	}
+	return reallocateItems(items, count, newCapacity, typename std::is_trivially_copyable<ItemType>::type());
+}
+
+// Capacity to grow to so that needed items fit; at least doubles, like adding one at a time
+inline int grownCapacity(int capacity, int needed)
+{
+	return (needed > 2 * capacity) ? needed : 2 * capacity;
+}
+
+// Number of items in [first, last), or -1 when the range can only be read once
+template<class InputIterator>
+int rangeLength(InputIterator, InputIterator, std::input_iterator_tag)
+{
+	return -1;
+}
+
+template<class ForwardIterator>
+int rangeLength(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+{
+	return static_cast<int>(std::distance(first, last));
+}
+
+template<class InputIterator>
+int rangeLength(InputIterator first, InputIterator last)
+{
+	return rangeLength(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+}
+#endif // !_ARRAY_STORAGE_H_
@@ -1,363 +1,1460 @@
-// Bag.h
-#ifndef _BAG_H_
-#define _BAG_H_
-#include "Node.h"
-
-template<typename ItemType>
-class BagInterface
-{
-public:
-	virtual int getCurrentSize() const = 0;
-	virtual bool isEmpty() const = 0;
-	virtual bool add(const ItemType& newEntry) = 0;
-	virtual bool remove(const ItemType& anEntry) = 0;
-	virtual void clear() = 0;
-	virtual int getFrequencyOf(const ItemType& anEntry) const = 0;
-	virtual bool contains(const ItemType& anEntry) const = 0;
-	virtual void print() const = 0;
-};
-
-template<typename ItemType>
-class LinkedBag : public BagInterface<ItemType>
-{
-private:
-	Node<ItemType>* headPtr; // Pointer to first node
-	int itemCount;           // Current count of bag items
-	Node<ItemType>* getPointerTo(const ItemType& target) const;
-							 // Returns either a pointer to the node containing a given entry
-							 // or the null pointer if the entry is not in the bag.
-public:
-	LinkedBag();
-	LinkedBag(const LinkedBag<ItemType>& aBag); // Copy constructor
-	virtual ~LinkedBag();                       // Destructor should be virtual
-	int getCurrentSize() const;
-	bool isEmpty() const;
-	bool add(const ItemType& newEntry);
-	bool remove(const ItemType& anEntry);
-	void clear();
-	bool contains(const ItemType& anEntry) const;
-	int getFrequencyOf(const ItemType& anEntry) const;
-	void print() const;
-};
-
-template<typename ItemType>
-class ArrayBag : public BagInterface<ItemType>
-{
-private:
-	static const int DEFAULT_CAPACITY = 6;
-	ItemType* items;
-	int itemCount;
-	int maxItems;
-	int getIndexOf(const ItemType& target) const;
-
-public:
-	ArrayBag();
-	ArrayBag(const ArrayBag<ItemType>& aBag);
-	~ArrayBag();
-	int getCurrentSize() const;
-	bool isEmpty() const;
-	bool add(const ItemType& newEntry);
-	bool remove(const ItemType& anEntry);
-	void clear();
-	bool contains(const ItemType& anEntry) const;
-	int getFrequencyOf(const ItemType& anEntry) const;
-	void print() const;
-	const ArrayBag<ItemType>& operator=(const ArrayBag<ItemType>& aBag);
-};
-
-//=================================================================================================
-// LinkedBag
-//=================================================================================================
-template<typename ItemType>
-LinkedBag<ItemType>::LinkedBag() : headPtr(nullptr), itemCount(0)
-{
-}
-
-template<typename ItemType>
-LinkedBag<ItemType>::LinkedBag(const LinkedBag<ItemType>& aBag)
-{
-	itemCount = aBag.itemCount;
-	Node<ItemType>* origChainPtr = aBag.headPtr; // Points to nodes in original chain
-
-	if (origChainPtr == nullptr)
-		headPtr = nullptr;  // Original bag is empty; so is copy
-	else
-	{
-		// Copy first node
-		Node<ItemType>* newChainPtr = headPtr;
-		newChainPtr = new Node<ItemType>(origChainPtr->item);
-
-		// Copy remaining nodes
-		origChainPtr = origChainPtr->next;
-		while (origChainPtr != nullptr)
-		{
-			newChainPtr->next = new Node<ItemType>(origChainPtr->item);
-			newChainPtr = newChainPtr->next;
-			origChainPtr = origChainPtr->next;
-		}
-
-		newChainPtr->next = nullptr; // Flag end of new chain
-	}
-}
-
-template<typename ItemType>
-LinkedBag<ItemType>::~LinkedBag()
-{
-	clear();
-}
-
-template<typename ItemType>
-int LinkedBag<ItemType>::getCurrentSize() const
-{
-	return itemCount;
-}
-
-template<typename ItemType>
-bool LinkedBag<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<typename ItemType>
-bool LinkedBag<ItemType>::add(const ItemType& newEntry)
-{
-	// Add to beginning of chain: new node references rest of chain;
-	// (headPtr is null if chain is empty)        
-	Node<ItemType>* newNodePtr = new Node<ItemType>();
-	newNodePtr->item = newEntry;
-	newNodePtr->next = headPtr;  // New node points to chain
-
-	headPtr = newNodePtr;          // New node is now first node
-	itemCount++;
-
-	return true;
-}
-
-template<typename ItemType>
-bool LinkedBag<ItemType>::remove(const ItemType& anEntry)
-{
-	Node<ItemType>* entryNodePtr = getPointerTo(anEntry);
-	bool canRemoveItem = (!isEmpty() && (entryNodePtr != nullptr));
-	if (canRemoveItem)
-	{
-		// Copy data from first node to located node
-		entryNodePtr->item = headPtr->item;
-
-		// Delete first node
-		Node<ItemType>* nodeToDeletePtr = headPtr;
-		headPtr = headPtr->next;
-
-		// Releasing the space to the system
-		delete nodeToDeletePtr;
-		nodeToDeletePtr = nullptr;
-
-		itemCount--;
-	}
-
-	return canRemoveItem;
-}
-
-template<typename ItemType>
-void LinkedBag<ItemType>::clear()
-{
-	Node<ItemType>* nodeToDeletePtr = headPtr;
-	while (headPtr != nullptr)
-	{
-		headPtr = headPtr->next;
-
-		// Releasing the space to the system
-		nodeToDeletePtr->next = nullptr;
-		delete nodeToDeletePtr;
-
-		nodeToDeletePtr = headPtr;
-	}
-	// headPtr is nullptr; nodeToDeletePtr is nullptr
-
-	itemCount = 0;
-}
-
-template<typename ItemType>
-bool LinkedBag<ItemType>::contains(const ItemType& anEntry) const
-{
-	return (getPointerTo(anEntry) != nullptr);
-}
-
-template<typename ItemType>
-int LinkedBag<ItemType>::getFrequencyOf(const ItemType& anEntry) const
-{
-	int frequency = 0;
-	Node<ItemType>* curPtr = headPtr;
-	while (curPtr != nullptr)
-	{
-		if (anEntry == curPtr->item)
-			frequency++;
-		curPtr = curPtr->next;
-	}
-
-	return frequency;
-}
-
-template<typename ItemType>
-void LinkedBag<ItemType>::print() const
-{
-	Node<ItemType>* curPtr = headPtr;
-	for (int i = 0 ; i < itemCount ; i++) {
-		cout << curPtr->item << " ";
-		curPtr = curPtr->next;
-	}
-	cout << endl;
-}
-
-// private
-// Returns either a pointer to the node containing a given entry
-// or the null pointer if the entry is not in the bag.
-template<typename ItemType>
-Node<ItemType>* LinkedBag<ItemType>::getPointerTo(const ItemType& anEntry) const
-{
-	bool found = false;
-	Node<ItemType>* curPtr = headPtr;
-
-	while (!found && (curPtr != nullptr))
-	{
-		if (anEntry == curPtr->item)
-			found = true;
-		else
-			curPtr = curPtr->next;
-	}
-
-	return curPtr;
-}
-
-//=================================================================================================
-// ArrayBag
-//=================================================================================================
-template<typename ItemType>
-ArrayBag<ItemType>::ArrayBag() : itemCount(0), maxItems(DEFAULT_CAPACITY)
-{
-	items = new ItemType[DEFAULT_CAPACITY];
-}
-
-template<typename ItemType>
-ArrayBag<ItemType>::ArrayBag(const ArrayBag<ItemType>& aBag) {
-	this->itemCount = aBag.itemCount;
-	this->maxItems = aBag.maxItems;
-	this->items = new ItemType[this->maxItems];
-	for (int i = 0 ; i < this->itemCount ; i++) {
-		this->items[i] = aBag.items[i];
-	}
-}
-
-template<typename ItemType>
-ArrayBag<ItemType>::~ArrayBag()
-{
-	delete[] items;
-}
-
-template<typename ItemType>
-int ArrayBag<ItemType>::getCurrentSize() const
-{
-	return itemCount;
-}
-
-template<typename ItemType>
-bool ArrayBag<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<typename ItemType>
-bool ArrayBag<ItemType>::add(const ItemType& newEntry)
-{
-	bool hasRoomToAdd = (itemCount < maxItems);
-	if (!hasRoomToAdd)
-	{
-		ItemType* oldArray = items;
-		items = new ItemType[2 * maxItems];
-		for (int i = 0; i < maxItems; i++)
-			items[i] = oldArray[i];
-		delete[] oldArray;
-		maxItems *= 2;
-	}
-	items[itemCount] = newEntry;
-	itemCount++;
-	
-	return true;
-}
-
-template<typename ItemType>
-bool ArrayBag<ItemType>::remove(const ItemType& anEntry)
-{
-	int locatedIndex = getIndexOf(anEntry);
-	bool canRemoveItem = (locatedIndex > -1);
-	if (canRemoveItem)
-	{
-		itemCount--;
-		items[locatedIndex] = items[itemCount];
-	}
-	return canRemoveItem;
-}
-
-template<typename ItemType>
-void ArrayBag<ItemType>::clear()
-{
-	itemCount = 0;
-}
-
-template<typename ItemType>
-bool ArrayBag<ItemType>::contains(const ItemType& anEntry) const
-{
-	return getIndexOf(anEntry) > -1;
-}
-
-template<typename ItemType>
-int ArrayBag<ItemType>::getFrequencyOf(const ItemType& anEntry) const
-{
-	int frequency = 0;
-	int curIndex = 0;
-	while (curIndex < itemCount)
-	{
-		if (items[curIndex] == anEntry)
-			frequency++;
-		curIndex++;
-	}
-	return frequency;
-}
-
-template<typename ItemType>
-void ArrayBag<ItemType>::print() const
-{
-	for (int i = 0; i < itemCount; i++)
-		cout << items[i] << " ";
-	cout << endl;
-}
-
-template<typename ItemType>
-const ArrayBag<ItemType>& ArrayBag<ItemType>::operator=(const ArrayBag<ItemType>& aBag)
-{
-	if (this != &aBag) {
-		if (this->itemCount != aBag.itemCount) {
-			if (this->maxItems != aBag.maxItems) {
-				this->maxItems = aBag.maxItems;
-				delete[] this->items;
-				this->items = new ItemType[this->maxItems];
-			}
-			this->itemCount = aBag.itemCount;
-		}
-		for (int i = 0; i < this->itemCount; i++) {
-			this->items[i] = aBag.items[i];
-		}
-	}
-	return *this;
-}
-
-// private
-template<typename ItemType>
-int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
-{
-	for (int i = 0; i < itemCount; i++) {
-		if (items[i] == target)
-			return i;
-	}
-	return -1;
-}
-#endif // !_BAG_H_
+// Bag.h
+#ifndef _BAG_H_
+#define _BAG_H_
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include "Node.h"
+#include "ArrayScan.h"
+#include "ArrayStorage.h"
+
+template<typename ItemType>
+class BagInterface
+{
+public:
+	virtual int getCurrentSize() const = 0;
+	virtual bool isEmpty() const = 0;
+	virtual bool add(const ItemType& newEntry) = 0;
+	virtual bool remove(const ItemType& anEntry) = 0;
+	virtual void clear() = 0;
+	virtual int getFrequencyOf(const ItemType& anEntry) const = 0;
+	virtual bool contains(const ItemType& anEntry) const = 0;
+	virtual void print() const = 0;
+};
+
+template<typename ItemType, class Allocator = NodeAllocator<ItemType> >
+class LinkedBag : public BagInterface<ItemType>
+{
+private:
+	Node<ItemType>* headPtr; // Pointer to first node
+	int itemCount;           // Current count of bag items
+	Allocator nodeAlloc;     // Source of the nodes (ex: NodePool<ItemType>)
+	Node<ItemType>* getPointerTo(const ItemType& target) const;
+							 // Returns either a pointer to the node containing a given entry
+							 // or the null pointer if the entry is not in the bag.
+public:
+	typedef NodeIterator<ItemType> iterator;
+	typedef NodeIterator<ItemType, const ItemType> const_iterator;
+
+	LinkedBag();
+	template<class InputIterator>
+	LinkedBag(InputIterator first, InputIterator last);    // Bag of the items in [first, last)
+	LinkedBag(const LinkedBag<ItemType, Allocator>& aBag); // Copy constructor
+	LinkedBag(LinkedBag<ItemType, Allocator>&& aBag);      // Move constructor
+	virtual ~LinkedBag();                       // Destructor should be virtual
+	int getCurrentSize() const;
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args); // builds the new entry in place
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last); // adds every item in [first, last)
+	bool remove(const ItemType& anEntry);
+	void clear();
+	bool contains(const ItemType& anEntry) const;
+	int getFrequencyOf(const ItemType& anEntry) const;
+	void print() const;
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const LinkedBag<ItemType, Allocator>& operator=(LinkedBag<ItemType, Allocator>&& aBag);
+};
+
+template<typename ItemType, class Hash>
+class CountingBag;
+
+template<typename ItemType>
+class ArrayBag : public BagInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 6;
+	ItemType* items; // uninitialized past itemCount
+	int itemCount;
+	int maxItems;
+	int getIndexOf(const ItemType& target) const;
+
+	template<typename, class> friend class CountingBag; // converts without going through add()
+
+public:
+	typedef ItemType* iterator;
+	typedef const ItemType* const_iterator;
+
+	ArrayBag();
+	template<class InputIterator>
+	ArrayBag(InputIterator first, InputIterator last);
+	ArrayBag(const ArrayBag<ItemType>& aBag);
+	ArrayBag(ArrayBag<ItemType>&& aBag);
+	~ArrayBag();
+	int getCurrentSize() const;
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last); // grows at most once for a forward range
+	bool remove(const ItemType& anEntry);
+	void clear();
+	bool contains(const ItemType& anEntry) const;
+	int getFrequencyOf(const ItemType& anEntry) const;
+	void print() const;
+	void reserve(int newCapacity); // makes room for newCapacity items (never shrinks)
+	void shrink_to_fit();          // gives back the capacity past getCurrentSize()
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const ArrayBag<ItemType>& operator=(const ArrayBag<ItemType>& aBag);
+	const ArrayBag<ItemType>& operator=(ArrayBag<ItemType>&& aBag);
+};
+
+// ArrayBag with a hash index: contains/getFrequencyOf/remove are O(1) expected.
+// items is kept dense like ArrayBag (remove moves the last item into the hole);
+// equal items are chained through prevIndex/nextIndex, and the open-addressing table
+// maps each distinct item to its count and the head of its chain.
+template<typename ItemType, class Hash = hash<ItemType> >
+class HashedBag : public BagInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 6;
+	static const int DEFAULT_TABLE_SIZE = 16; // must be a power of 2
+	struct HashEntry
+	{
+		alignas(ItemType) unsigned char storage[sizeof(ItemType)]; // the item, constructed while count > 0
+		int count;     // 0 means the entry is empty
+		int headIndex; // index in items of the first copy
+		ItemType& item() { return *reinterpret_cast<ItemType*>(storage); }
+	};
+	ItemType* items; // uninitialized past itemCount
+	int* prevIndex; // previous index holding an equal item, -1 if none
+	int* nextIndex; // next index holding an equal item, -1 if none
+	int itemCount;
+	int maxItems;
+	HashEntry* table;
+	int tableSize;
+	int distinctCount;
+	Hash hasher;
+
+	int findEntry(const ItemType& target) const; // index of target's entry, or of the empty entry where it would go
+	void eraseEntry(int entryIndex);
+	void rehash(int newTableSize);
+	void growItems(int newMaxItems);
+	void initEmpty();
+	void releaseAll(); // destroys every item and frees the arrays
+	void copyFrom(const HashedBag<ItemType, Hash>& aBag);
+	void moveFrom(HashedBag<ItemType, Hash>& aBag);
+	template<class T>
+	bool addEntry(T&& newEntry);
+public:
+	// the items cannot be changed in place: the table is keyed on them
+	typedef const ItemType* iterator;
+	typedef const ItemType* const_iterator;
+
+	HashedBag();
+	template<class InputIterator>
+	HashedBag(InputIterator first, InputIterator last);
+	HashedBag(const HashedBag<ItemType, Hash>& aBag);
+	HashedBag(HashedBag<ItemType, Hash>&& aBag);
+	~HashedBag();
+	int getCurrentSize() const;
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	bool remove(const ItemType& anEntry);
+	void clear();
+	bool contains(const ItemType& anEntry) const;
+	int getFrequencyOf(const ItemType& anEntry) const;
+	void print() const;
+	const_iterator begin() const;
+	const_iterator end() const;
+	const HashedBag<ItemType, Hash>& operator=(const HashedBag<ItemType, Hash>& aBag);
+	const HashedBag<ItemType, Hash>& operator=(HashedBag<ItemType, Hash>&& aBag);
+};
+
+// Bag stored as (item, multiplicity) pairs: memory is proportional to the number of
+// distinct items, and add/remove of n copies at once is O(1) expected.
+// The pairs are kept dense in items/counts; the open-addressing table holds their indices.
+template<typename ItemType, class Hash = hash<ItemType> >
+class CountingBag : public BagInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 6;
+	static const int DEFAULT_TABLE_SIZE = 16; // must be a power of 2
+	ItemType* items; // distinct items; uninitialized past distinctCount
+	int* counts;     // counts[i] is the multiplicity of items[i]
+	int distinctCount;
+	int maxItems;
+	int itemCount;   // sum of all multiplicities
+	int* table;      // index into items, -1 means empty
+	int tableSize;
+	Hash hasher;
+
+	int findSlot(const ItemType& target) const; // table slot of target, or the empty slot where it would go
+	void eraseSlot(int slot);
+	void rehash(int newTableSize);
+	void initEmpty();
+	void releaseAll(); // destroys every item and frees the arrays
+	void copyFrom(const CountingBag<ItemType, Hash>& aBag);
+	void moveFrom(CountingBag<ItemType, Hash>& aBag);
+	template<class T>
+	bool addEntry(T&& newEntry, int n);
+public:
+	// Forward iterator that gives every copy: a distinct item comes up as many times as it is
+	// in the bag, its copies one after the other. The items cannot be changed in place.
+	class const_iterator
+	{
+	private:
+		const ItemType* itemPtr;
+		const int* countPtr; // multiplicity of *itemPtr
+		int copyIndex;       // copies of *itemPtr already passed
+	public:
+		typedef forward_iterator_tag iterator_category;
+		typedef ItemType value_type;
+		typedef ptrdiff_t difference_type;
+		typedef const ItemType* pointer;
+		typedef const ItemType& reference;
+
+		const_iterator() : itemPtr(nullptr), countPtr(nullptr), copyIndex(0) {}
+		const_iterator(const ItemType* anItemPtr, const int* aCountPtr) : itemPtr(anItemPtr), countPtr(aCountPtr), copyIndex(0) {}
+		reference operator*() const { return *itemPtr; }
+		pointer operator->() const { return itemPtr; }
+		const_iterator& operator++()
+		{
+			if(++copyIndex == *countPtr)
+			{
+				itemPtr++;
+				countPtr++;
+				copyIndex = 0;
+			}
+			return *this;
+		}
+		const_iterator operator++(int) { const_iterator oldIterator(*this); ++(*this); return oldIterator; }
+		bool operator==(const const_iterator& anIterator) const { return (itemPtr == anIterator.itemPtr) && (copyIndex == anIterator.copyIndex); }
+		bool operator!=(const const_iterator& anIterator) const { return !(*this == anIterator); }
+	};
+	typedef const_iterator iterator;
+
+	CountingBag();
+	template<class InputIterator>
+	CountingBag(InputIterator first, InputIterator last);
+	CountingBag(const CountingBag<ItemType, Hash>& aBag);
+	CountingBag(CountingBag<ItemType, Hash>&& aBag);
+	CountingBag(const ArrayBag<ItemType>& aBag);
+	~CountingBag();
+	int getCurrentSize() const;
+	int getDistinctCount() const;
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	bool add(const ItemType& newEntry, int n);  // adds n copies
+	bool add(ItemType&& newEntry, int n);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	bool remove(const ItemType& anEntry);
+	bool remove(const ItemType& anEntry, int n); // removes n copies; fails if there are fewer
+	void clear();
+	bool contains(const ItemType& anEntry) const;
+	int getFrequencyOf(const ItemType& anEntry) const;
+	void print() const;
+	ArrayBag<ItemType> toArrayBag() const;
+	const_iterator begin() const;
+	const_iterator end() const;
+	const CountingBag<ItemType, Hash>& operator=(const CountingBag<ItemType, Hash>& aBag);
+	const CountingBag<ItemType, Hash>& operator=(CountingBag<ItemType, Hash>&& aBag);
+};
+
+//=================================================================================================
+// LinkedBag
+//=================================================================================================
+template<typename ItemType, class Allocator>
+LinkedBag<ItemType, Allocator>::LinkedBag() : headPtr(nullptr), itemCount(0)
+{
+}
+
+template<typename ItemType, class Allocator>
+template<class InputIterator>
+LinkedBag<ItemType, Allocator>::LinkedBag(InputIterator first, InputIterator last) : headPtr(nullptr), itemCount(0)
+{
+	addAll(first, last);
+}
+
+template<typename ItemType, class Allocator>
+LinkedBag<ItemType, Allocator>::LinkedBag(const LinkedBag<ItemType, Allocator>& aBag)
+{
+	itemCount = aBag.itemCount;
+	Node<ItemType>* origChainPtr = aBag.headPtr; // Points to nodes in original chain
+
+	if (origChainPtr == nullptr)
+		headPtr = nullptr;  // Original bag is empty; so is copy
+	else
+	{
+		// Copy first node
+		headPtr = nodeAlloc.allocate(origChainPtr->item);
+		Node<ItemType>* newChainPtr = headPtr;
+
+		// Copy remaining nodes
+		origChainPtr = origChainPtr->next;
+		while (origChainPtr != nullptr)
+		{
+			newChainPtr->next = nodeAlloc.allocate(origChainPtr->item);
+			newChainPtr = newChainPtr->next;
+			origChainPtr = origChainPtr->next;
+		}
+
+		newChainPtr->next = nullptr; // Flag end of new chain
+	}
+}
+
+template<typename ItemType, class Allocator>
+LinkedBag<ItemType, Allocator>::LinkedBag(LinkedBag<ItemType, Allocator>&& aBag)
+	: headPtr(aBag.headPtr), itemCount(aBag.itemCount), nodeAlloc(move(aBag.nodeAlloc))
+{
+	aBag.headPtr = nullptr;
+	aBag.itemCount = 0;
+}
+
+template<typename ItemType, class Allocator>
+LinkedBag<ItemType, Allocator>::~LinkedBag()
+{
+	clear();
+}
+
+template<typename ItemType, class Allocator>
+int LinkedBag<ItemType, Allocator>::getCurrentSize() const
+{
+	return itemCount;
+}
+
+template<typename ItemType, class Allocator>
+bool LinkedBag<ItemType, Allocator>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<typename ItemType, class Allocator>
+bool LinkedBag<ItemType, Allocator>::add(const ItemType& newEntry)
+{
+	// Add to beginning of chain: new node references rest of chain;
+	// (headPtr is null if chain is empty)        
+	Node<ItemType>* newNodePtr = nodeAlloc.allocate(newEntry, headPtr); // New node points to chain
+
+	headPtr = newNodePtr;          // New node is now first node
+	itemCount++;
+
+	return true;
+}
+
+template<typename ItemType, class Allocator>
+bool LinkedBag<ItemType, Allocator>::add(ItemType&& newEntry)
+{
+	headPtr = nodeAlloc.allocate(move(newEntry), headPtr);
+	itemCount++;
+
+	return true;
+}
+
+template<typename ItemType, class Allocator>
+template<class... Args>
+bool LinkedBag<ItemType, Allocator>::emplace(Args&&... args)
+{
+	headPtr = nodeAlloc.emplace(headPtr, forward<Args>(args)...);
+	itemCount++;
+
+	return true;
+}
+
+template<typename ItemType, class Allocator>
+template<class InputIterator>
+bool LinkedBag<ItemType, Allocator>::addAll(InputIterator first, InputIterator last)
+{
+	for (; first != last; ++first)
+	{
+		headPtr = nodeAlloc.emplace(headPtr, *first);
+		itemCount++;
+	}
+
+	return true;
+}
+
+template<typename ItemType, class Allocator>
+bool LinkedBag<ItemType, Allocator>::remove(const ItemType& anEntry)
+{
+	Node<ItemType>* entryNodePtr = getPointerTo(anEntry);
+	bool canRemoveItem = (!isEmpty() && (entryNodePtr != nullptr));
+	if (canRemoveItem)
+	{
+		// Copy data from first node to located node
+		entryNodePtr->item = headPtr->item;
+
+		// Delete first node
+		Node<ItemType>* nodeToDeletePtr = headPtr;
+		headPtr = headPtr->next;
+
+		// Releasing the space to the allocator
+		nodeAlloc.deallocate(nodeToDeletePtr);
+		nodeToDeletePtr = nullptr;
+
+		itemCount--;
+	}
+
+	return canRemoveItem;
+}
+
+template<typename ItemType, class Allocator>
+void LinkedBag<ItemType, Allocator>::clear()
+{
+	// Releasing the whole chain to the allocator
+	nodeAlloc.deallocateAll(headPtr);
+	headPtr = nullptr;
+
+	itemCount = 0;
+}
+
+template<typename ItemType, class Allocator>
+bool LinkedBag<ItemType, Allocator>::contains(const ItemType& anEntry) const
+{
+	return (getPointerTo(anEntry) != nullptr);
+}
+
+template<typename ItemType, class Allocator>
+int LinkedBag<ItemType, Allocator>::getFrequencyOf(const ItemType& anEntry) const
+{
+	int frequency = 0;
+	Node<ItemType>* curPtr = headPtr;
+	while (curPtr != nullptr)
+	{
+		if (anEntry == curPtr->item)
+			frequency++;
+		curPtr = curPtr->next;
+	}
+
+	return frequency;
+}
+
+template<typename ItemType, class Allocator>
+void LinkedBag<ItemType, Allocator>::print() const
+{
+	Node<ItemType>* curPtr = headPtr;
+	for (int i = 0 ; i < itemCount ; i++) {
+		cout << curPtr->item << " ";
+		curPtr = curPtr->next;
+	}
+	cout << endl;
+}
+
+template<typename ItemType, class Allocator>
+typename LinkedBag<ItemType, Allocator>::iterator LinkedBag<ItemType, Allocator>::begin()
+{
+	return iterator(headPtr);
+}
+
+template<typename ItemType, class Allocator>
+typename LinkedBag<ItemType, Allocator>::iterator LinkedBag<ItemType, Allocator>::end()
+{
+	return iterator();
+}
+
+template<typename ItemType, class Allocator>
+typename LinkedBag<ItemType, Allocator>::const_iterator LinkedBag<ItemType, Allocator>::begin() const
+{
+	return const_iterator(headPtr);
+}
+
+template<typename ItemType, class Allocator>
+typename LinkedBag<ItemType, Allocator>::const_iterator LinkedBag<ItemType, Allocator>::end() const
+{
+	return const_iterator();
+}
+
+template<typename ItemType, class Allocator>
+const LinkedBag<ItemType, Allocator>& LinkedBag<ItemType, Allocator>::operator=(LinkedBag<ItemType, Allocator>&& aBag)
+{
+	if (this != &aBag) {
+		clear();
+		headPtr = aBag.headPtr;
+		itemCount = aBag.itemCount;
+		nodeAlloc = move(aBag.nodeAlloc);
+		aBag.headPtr = nullptr;
+		aBag.itemCount = 0;
+	}
+	return *this;
+}
+
+// private
+// Returns either a pointer to the node containing a given entry
+// or the null pointer if the entry is not in the bag.
+template<typename ItemType, class Allocator>
+Node<ItemType>* LinkedBag<ItemType, Allocator>::getPointerTo(const ItemType& anEntry) const
+{
+	bool found = false;
+	Node<ItemType>* curPtr = headPtr;
+
+	while (!found && (curPtr != nullptr))
+	{
+		if (anEntry == curPtr->item)
+			found = true;
+		else
+			curPtr = curPtr->next;
+	}
+
+	return curPtr;
+}
+
+//=================================================================================================
+// ArrayBag
+//=================================================================================================
+template<typename ItemType>
+ArrayBag<ItemType>::ArrayBag() : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(DEFAULT_CAPACITY);
+}
+
+template<typename ItemType>
+template<class InputIterator>
+ArrayBag<ItemType>::ArrayBag(InputIterator first, InputIterator last) : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(DEFAULT_CAPACITY);
+	addAll(first, last);
+}
+
+template<typename ItemType>
+ArrayBag<ItemType>::ArrayBag(const ArrayBag<ItemType>& aBag) {
+	this->itemCount = aBag.itemCount;
+	this->maxItems = aBag.maxItems;
+	this->items = allocateItems<ItemType>(this->maxItems);
+	copyItems(this->items, aBag.items, this->itemCount);
+}
+
+template<typename ItemType>
+ArrayBag<ItemType>::ArrayBag(ArrayBag<ItemType>&& aBag)
+	: items(aBag.items), itemCount(aBag.itemCount), maxItems(aBag.maxItems)
+{
+	// aBag is left empty with no capacity; its next add() allocates again
+	aBag.items = nullptr;
+	aBag.itemCount = 0;
+	aBag.maxItems = 0;
+}
+
+template<typename ItemType>
+ArrayBag<ItemType>::~ArrayBag()
+{
+	destroyItems(items, 0, itemCount);
+	freeItems(items);
+}
+
+template<typename ItemType>
+int ArrayBag<ItemType>::getCurrentSize() const
+{
+	return itemCount;
+}
+
+template<typename ItemType>
+bool ArrayBag<ItemType>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<typename ItemType>
+bool ArrayBag<ItemType>::add(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<typename ItemType>
+bool ArrayBag<ItemType>::add(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<typename ItemType>
+template<class... Args>
+bool ArrayBag<ItemType>::emplace(Args&&... args)
+{
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if (hasRoomToAdd)
+	{
+		new (&items[itemCount]) ItemType(forward<Args>(args)...);
+	}
+	else
+	{
+		ItemType newEntry(forward<Args>(args)...); // before growing: args may refer into items
+		reserve((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+		new (&items[itemCount]) ItemType(move(newEntry));
+	}
+	itemCount++;
+	
+	return true;
+}
+
+template<typename ItemType>
+template<class InputIterator>
+bool ArrayBag<ItemType>::addAll(InputIterator first, InputIterator last)
+{
+	int count = rangeLength(first, last);
+	if (count < 0) // single pass: no way to know the size up front
+	{
+		for (; first != last; ++first)
+			emplace(*first);
+		return true;
+	}
+
+	if (itemCount + count > maxItems)
+		reserve(grownCapacity(maxItems, itemCount + count));
+	for (; first != last; ++first)
+	{
+		new (&items[itemCount]) ItemType(*first);
+		itemCount++;
+	}
+
+	return true;
+}
+
+template<typename ItemType>
+bool ArrayBag<ItemType>::remove(const ItemType& anEntry)
+{
+	int locatedIndex = getIndexOf(anEntry);
+	bool canRemoveItem = (locatedIndex > -1);
+	if (canRemoveItem)
+	{
+		itemCount--;
+		if (locatedIndex != itemCount)
+			items[locatedIndex] = move(items[itemCount]);
+		destroyItems(items, itemCount, itemCount + 1);
+	}
+	return canRemoveItem;
+}
+
+template<typename ItemType>
+void ArrayBag<ItemType>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+}
+
+template<typename ItemType>
+bool ArrayBag<ItemType>::contains(const ItemType& anEntry) const
+{
+	return getIndexOf(anEntry) > -1;
+}
+
+template<typename ItemType>
+int ArrayBag<ItemType>::getFrequencyOf(const ItemType& anEntry) const
+{
+	return arrayCountEqual(items, itemCount, anEntry);
+}
+
+template<typename ItemType>
+void ArrayBag<ItemType>::print() const
+{
+	for (int i = 0; i < itemCount; i++)
+		cout << items[i] << " ";
+	cout << endl;
+}
+
+template<typename ItemType>
+void ArrayBag<ItemType>::reserve(int newCapacity)
+{
+	if (newCapacity > maxItems)
+	{
+		items = reallocateItems(items, itemCount, newCapacity);
+		maxItems = newCapacity;
+	}
+}
+
+template<typename ItemType>
+void ArrayBag<ItemType>::shrink_to_fit()
+{
+	if (itemCount < maxItems)
+	{
+		items = reallocateItems(items, itemCount, itemCount);
+		maxItems = itemCount;
+	}
+}
+
+template<typename ItemType>
+typename ArrayBag<ItemType>::iterator ArrayBag<ItemType>::begin()
+{
+	return items;
+}
+
+template<typename ItemType>
+typename ArrayBag<ItemType>::iterator ArrayBag<ItemType>::end()
+{
+	return items + itemCount;
+}
+
+template<typename ItemType>
+typename ArrayBag<ItemType>::const_iterator ArrayBag<ItemType>::begin() const
+{
+	return items;
+}
+
+template<typename ItemType>
+typename ArrayBag<ItemType>::const_iterator ArrayBag<ItemType>::end() const
+{
+	return items + itemCount;
+}
+
+template<typename ItemType>
+const ArrayBag<ItemType>& ArrayBag<ItemType>::operator=(const ArrayBag<ItemType>& aBag)
+{
+	if (this != &aBag) {
+		destroyItems(this->items, 0, this->itemCount);
+		this->itemCount = 0;
+		if (this->maxItems < aBag.itemCount) {
+			freeItems(this->items);
+			this->items = nullptr; // in case the allocation throws
+			this->maxItems = 0;
+			this->items = allocateItems<ItemType>(aBag.maxItems);
+			this->maxItems = aBag.maxItems;
+		}
+		copyItems(this->items, aBag.items, aBag.itemCount);
+		this->itemCount = aBag.itemCount;
+	}
+	return *this;
+}
+
+template<typename ItemType>
+const ArrayBag<ItemType>& ArrayBag<ItemType>::operator=(ArrayBag<ItemType>&& aBag)
+{
+	if (this != &aBag) {
+		destroyItems(this->items, 0, this->itemCount);
+		freeItems(this->items);
+		this->items = aBag.items;
+		this->itemCount = aBag.itemCount;
+		this->maxItems = aBag.maxItems;
+		aBag.items = nullptr;
+		aBag.itemCount = 0;
+		aBag.maxItems = 0;
+	}
+	return *this;
+}
+
+// private
+template<typename ItemType>
+int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
+{
+	return arrayIndexOf(items, itemCount, target);
+}
+
+//=================================================================================================
+// HashedBag
+//=================================================================================================
+template<typename ItemType, class Hash>
+HashedBag<ItemType, Hash>::HashedBag()
+{
+	initEmpty();
+}
+
+template<typename ItemType, class Hash>
+template<class InputIterator>
+HashedBag<ItemType, Hash>::HashedBag(InputIterator first, InputIterator last)
+{
+	initEmpty();
+	addAll(first, last);
+}
+
+template<typename ItemType, class Hash>
+HashedBag<ItemType, Hash>::HashedBag(const HashedBag<ItemType, Hash>& aBag)
+{
+	copyFrom(aBag);
+}
+
+template<typename ItemType, class Hash>
+HashedBag<ItemType, Hash>::HashedBag(HashedBag<ItemType, Hash>&& aBag)
+{
+	moveFrom(aBag);
+}
+
+template<typename ItemType, class Hash>
+HashedBag<ItemType, Hash>::~HashedBag()
+{
+	releaseAll();
+}
+
+template<typename ItemType, class Hash>
+int HashedBag<ItemType, Hash>::getCurrentSize() const
+{
+	return itemCount;
+}
+
+template<typename ItemType, class Hash>
+bool HashedBag<ItemType, Hash>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<typename ItemType, class Hash>
+bool HashedBag<ItemType, Hash>::add(const ItemType& newEntry)
+{
+	return addEntry(newEntry);
+}
+
+template<typename ItemType, class Hash>
+bool HashedBag<ItemType, Hash>::add(ItemType&& newEntry)
+{
+	return addEntry(move(newEntry));
+}
+
+template<typename ItemType, class Hash>
+template<class... Args>
+bool HashedBag<ItemType, Hash>::emplace(Args&&... args)
+{
+	return addEntry(ItemType(forward<Args>(args)...)); // must exist to be hashed
+}
+
+template<typename ItemType, class Hash>
+template<class InputIterator>
+bool HashedBag<ItemType, Hash>::addAll(InputIterator first, InputIterator last)
+{
+	int count = rangeLength(first, last);
+	if (itemCount + count > maxItems) // the table still grows by distinct items as they come
+		growItems(grownCapacity(maxItems, itemCount + count));
+	for (; first != last; ++first)
+		addEntry(*first);
+
+	return true;
+}
+
+// private
+template<typename ItemType, class Hash>
+template<class T>
+bool HashedBag<ItemType, Hash>::addEntry(T&& newEntry)
+{
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if (!hasRoomToAdd)
+		growItems(2 * maxItems);
+
+	int entryIndex = findEntry(newEntry);
+	if (table[entryIndex].count == 0) // first copy of newEntry
+	{
+		if (2 * (distinctCount + 1) > tableSize) // keep the load factor at most 1/2
+		{
+			rehash(2 * tableSize);
+			entryIndex = findEntry(newEntry);
+		}
+		new (&table[entryIndex].item()) ItemType(newEntry);
+		table[entryIndex].headIndex = -1;
+		distinctCount++;
+	}
+	new (&items[itemCount]) ItemType(forward<T>(newEntry));
+
+	// new copy becomes the head of the chain of equal items
+	int oldHead = table[entryIndex].headIndex;
+	prevIndex[itemCount] = -1;
+	nextIndex[itemCount] = oldHead;
+	if (oldHead != -1)
+		prevIndex[oldHead] = itemCount;
+	table[entryIndex].headIndex = itemCount;
+	table[entryIndex].count++;
+	itemCount++;
+
+	return true;
+}
+
+template<typename ItemType, class Hash>
+bool HashedBag<ItemType, Hash>::remove(const ItemType& anEntry)
+{
+	int entryIndex = findEntry(anEntry);
+	bool canRemoveItem = (table[entryIndex].count > 0);
+	if (canRemoveItem)
+	{
+		// unlink the head of anEntry's chain
+		int locatedIndex = table[entryIndex].headIndex;
+		int newHead = nextIndex[locatedIndex];
+		if (newHead != -1)
+			prevIndex[newHead] = -1;
+		table[entryIndex].headIndex = newHead;
+		table[entryIndex].count--;
+		if (table[entryIndex].count == 0)
+			eraseEntry(entryIndex);
+
+		// move the last item into the hole, like ArrayBag
+		itemCount--;
+		if (locatedIndex != itemCount)
+		{
+			items[locatedIndex] = move(items[itemCount]);
+			prevIndex[locatedIndex] = prevIndex[itemCount];
+			nextIndex[locatedIndex] = nextIndex[itemCount];
+			if (prevIndex[locatedIndex] != -1)
+				nextIndex[prevIndex[locatedIndex]] = locatedIndex;
+			else
+				table[findEntry(items[locatedIndex])].headIndex = locatedIndex;
+			if (nextIndex[locatedIndex] != -1)
+				prevIndex[nextIndex[locatedIndex]] = locatedIndex;
+		}
+		destroyItems(items, itemCount, itemCount + 1);
+	}
+	return canRemoveItem;
+}
+
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::clear()
+{
+	for (int i = 0; i < tableSize; i++)
+	{
+		if (table[i].count != 0)
+			destroyItems(&table[i].item(), 0, 1);
+		table[i].count = 0;
+	}
+	destroyItems(items, 0, itemCount);
+	distinctCount = 0;
+	itemCount = 0;
+}
+
+template<typename ItemType, class Hash>
+bool HashedBag<ItemType, Hash>::contains(const ItemType& anEntry) const
+{
+	return (table[findEntry(anEntry)].count > 0);
+}
+
+template<typename ItemType, class Hash>
+int HashedBag<ItemType, Hash>::getFrequencyOf(const ItemType& anEntry) const
+{
+	return table[findEntry(anEntry)].count;
+}
+
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::print() const
+{
+	for (int i = 0; i < itemCount; i++)
+		cout << items[i] << " ";
+	cout << endl;
+}
+
+template<typename ItemType, class Hash>
+typename HashedBag<ItemType, Hash>::const_iterator HashedBag<ItemType, Hash>::begin() const
+{
+	return items;
+}
+
+template<typename ItemType, class Hash>
+typename HashedBag<ItemType, Hash>::const_iterator HashedBag<ItemType, Hash>::end() const
+{
+	return items + itemCount;
+}
+
+template<typename ItemType, class Hash>
+const HashedBag<ItemType, Hash>& HashedBag<ItemType, Hash>::operator=(const HashedBag<ItemType, Hash>& aBag)
+{
+	if (this != &aBag) {
+		releaseAll();
+		copyFrom(aBag);
+	}
+	return *this;
+}
+
+template<typename ItemType, class Hash>
+const HashedBag<ItemType, Hash>& HashedBag<ItemType, Hash>::operator=(HashedBag<ItemType, Hash>&& aBag)
+{
+	if (this != &aBag) {
+		releaseAll();
+		moveFrom(aBag);
+	}
+	return *this;
+}
+
+// private
+template<typename ItemType, class Hash>
+int HashedBag<ItemType, Hash>::findEntry(const ItemType& target) const
+{
+	int mask = tableSize - 1;
+	int i = static_cast<int>(hasher(target) & mask);
+	while (table[i].count != 0 && !(table[i].item() == target))
+		i = (i + 1) & mask; // linear probing
+	return i;
+}
+
+// private
+// Backward-shift deletion: pull later entries of the probe run into the hole,
+// so the table never needs tombstones.
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::eraseEntry(int entryIndex)
+{
+	int mask = tableSize - 1;
+	int hole = entryIndex;
+	int i = (hole + 1) & mask;
+	while (table[i].count != 0)
+	{
+		int home = static_cast<int>(hasher(table[i].item()) & mask);
+		// table[i] may fill the hole only if its home is not in (hole, i]
+		bool homeInRange = (hole <= i) ? (hole < home && home <= i)
+									   : (hole < home || home <= i);
+		if (!homeInRange)
+		{
+			table[hole].item() = move(table[i].item());
+			table[hole].count = table[i].count;
+			table[hole].headIndex = table[i].headIndex;
+			hole = i;
+		}
+		i = (i + 1) & mask;
+	}
+	destroyItems(&table[hole].item(), 0, 1);
+	table[hole].count = 0;
+	distinctCount--;
+}
+
+// private
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::rehash(int newTableSize)
+{
+	HashEntry* oldTable = table;
+	int oldTableSize = tableSize;
+	table = allocateItems<HashEntry>(newTableSize);
+	tableSize = newTableSize;
+	for (int i = 0; i < tableSize; i++)
+		table[i].count = 0;
+	for (int i = 0; i < oldTableSize; i++)
+	{
+		if (oldTable[i].count != 0)
+		{
+			HashEntry& newEntry = table[findEntry(oldTable[i].item())];
+			relocateItems(&newEntry.item(), &oldTable[i].item(), 1);
+			newEntry.count = oldTable[i].count;
+			newEntry.headIndex = oldTable[i].headIndex;
+		}
+	}
+	freeItems(oldTable);
+}
+
+// private
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::growItems(int newMaxItems)
+{
+	items = reallocateItems(items, itemCount, newMaxItems);
+	prevIndex = reallocateItems(prevIndex, itemCount, newMaxItems);
+	nextIndex = reallocateItems(nextIndex, itemCount, newMaxItems);
+	maxItems = newMaxItems;
+}
+
+// private
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::initEmpty()
+{
+	itemCount = 0;
+	maxItems = DEFAULT_CAPACITY;
+	tableSize = DEFAULT_TABLE_SIZE;
+	distinctCount = 0;
+	items = allocateItems<ItemType>(maxItems);
+	prevIndex = allocateItems<int>(maxItems);
+	nextIndex = allocateItems<int>(maxItems);
+	table = allocateItems<HashEntry>(tableSize);
+	for (int i = 0; i < tableSize; i++)
+		table[i].count = 0;
+}
+
+// private
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::releaseAll()
+{
+	clear();
+	freeItems(items);
+	freeItems(prevIndex);
+	freeItems(nextIndex);
+	freeItems(table);
+}
+
+// private
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::copyFrom(const HashedBag<ItemType, Hash>& aBag)
+{
+	itemCount = aBag.itemCount;
+	maxItems = aBag.maxItems;
+	tableSize = aBag.tableSize;
+	distinctCount = aBag.distinctCount;
+	hasher = aBag.hasher;
+	items = allocateItems<ItemType>(maxItems);
+	prevIndex = allocateItems<int>(maxItems);
+	nextIndex = allocateItems<int>(maxItems);
+	copyItems(items, aBag.items, itemCount);
+	copyItems(prevIndex, aBag.prevIndex, itemCount);
+	copyItems(nextIndex, aBag.nextIndex, itemCount);
+	table = allocateItems<HashEntry>(tableSize);
+	for (int i = 0; i < tableSize; i++)
+	{
+		table[i].count = aBag.table[i].count;
+		table[i].headIndex = aBag.table[i].headIndex;
+		if (table[i].count != 0)
+			new (&table[i].item()) ItemType(aBag.table[i].item());
+	}
+}
+
+// private
+// Takes aBag's arrays and leaves aBag as a new empty bag.
+template<typename ItemType, class Hash>
+void HashedBag<ItemType, Hash>::moveFrom(HashedBag<ItemType, Hash>& aBag)
+{
+	items = aBag.items;
+	prevIndex = aBag.prevIndex;
+	nextIndex = aBag.nextIndex;
+	itemCount = aBag.itemCount;
+	maxItems = aBag.maxItems;
+	table = aBag.table;
+	tableSize = aBag.tableSize;
+	distinctCount = aBag.distinctCount;
+	hasher = move(aBag.hasher);
+	aBag.initEmpty();
+}
+
+//=================================================================================================
+// CountingBag
+//=================================================================================================
+template<typename ItemType, class Hash>
+CountingBag<ItemType, Hash>::CountingBag()
+{
+	initEmpty();
+}
+
+template<typename ItemType, class Hash>
+template<class InputIterator>
+CountingBag<ItemType, Hash>::CountingBag(InputIterator first, InputIterator last)
+{
+	initEmpty();
+	addAll(first, last);
+}
+
+template<typename ItemType, class Hash>
+CountingBag<ItemType, Hash>::CountingBag(const CountingBag<ItemType, Hash>& aBag)
+{
+	copyFrom(aBag);
+}
+
+template<typename ItemType, class Hash>
+CountingBag<ItemType, Hash>::CountingBag(CountingBag<ItemType, Hash>&& aBag)
+{
+	moveFrom(aBag);
+}
+
+template<typename ItemType, class Hash>
+CountingBag<ItemType, Hash>::CountingBag(const ArrayBag<ItemType>& aBag)
+{
+	initEmpty();
+	for (int i = 0; i < aBag.itemCount; i++)
+		add(aBag.items[i], 1);
+}
+
+template<typename ItemType, class Hash>
+CountingBag<ItemType, Hash>::~CountingBag()
+{
+	releaseAll();
+}
+
+template<typename ItemType, class Hash>
+int CountingBag<ItemType, Hash>::getCurrentSize() const
+{
+	return itemCount;
+}
+
+template<typename ItemType, class Hash>
+int CountingBag<ItemType, Hash>::getDistinctCount() const
+{
+	return distinctCount;
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::add(const ItemType& newEntry)
+{
+	return add(newEntry, 1);
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::add(ItemType&& newEntry)
+{
+	return addEntry(move(newEntry), 1);
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::add(const ItemType& newEntry, int n)
+{
+	return addEntry(newEntry, n);
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::add(ItemType&& newEntry, int n)
+{
+	return addEntry(move(newEntry), n);
+}
+
+template<typename ItemType, class Hash>
+template<class... Args>
+bool CountingBag<ItemType, Hash>::emplace(Args&&... args)
+{
+	return addEntry(ItemType(forward<Args>(args)...), 1); // must exist to be hashed
+}
+
+template<typename ItemType, class Hash>
+template<class InputIterator>
+bool CountingBag<ItemType, Hash>::addAll(InputIterator first, InputIterator last)
+{
+	// storage is per distinct item, which the range does not tell us; no point reserving
+	for (; first != last; ++first)
+		addEntry(*first, 1);
+
+	return true;
+}
+
+// private
+template<typename ItemType, class Hash>
+template<class T>
+bool CountingBag<ItemType, Hash>::addEntry(T&& newEntry, int n)
+{
+	if (n <= 0)
+		return false;
+
+	int slot = findSlot(newEntry);
+	if (table[slot] == -1) // first copy of newEntry
+	{
+		if (2 * (distinctCount + 1) > tableSize) // keep the load factor at most 1/2
+		{
+			rehash(2 * tableSize);
+			slot = findSlot(newEntry);
+		}
+
+		bool hasRoomToAdd = (distinctCount < maxItems);
+		if (!hasRoomToAdd)
+		{
+			items = reallocateItems(items, distinctCount, 2 * maxItems);
+			counts = reallocateItems(counts, distinctCount, 2 * maxItems);
+			maxItems *= 2;
+		}
+		new (&items[distinctCount]) ItemType(forward<T>(newEntry));
+		counts[distinctCount] = 0;
+		table[slot] = distinctCount;
+		distinctCount++;
+	}
+	counts[table[slot]] += n;
+	itemCount += n;
+
+	return true;
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::remove(const ItemType& anEntry)
+{
+	return remove(anEntry, 1);
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::remove(const ItemType& anEntry, int n)
+{
+	int slot = findSlot(anEntry);
+	bool canRemoveItem = (n > 0) && (table[slot] != -1) && (counts[table[slot]] >= n);
+	if (canRemoveItem)
+	{
+		int locatedIndex = table[slot];
+		counts[locatedIndex] -= n;
+		itemCount -= n;
+		if (counts[locatedIndex] == 0) // last copy is gone; drop the pair
+		{
+			eraseSlot(slot);
+			distinctCount--;
+			if (locatedIndex != distinctCount) // move the last pair into the hole
+			{
+				// find its slot while table still leads to items[distinctCount]
+				int movedSlot = findSlot(items[distinctCount]);
+				items[locatedIndex] = move(items[distinctCount]);
+				counts[locatedIndex] = counts[distinctCount];
+				table[movedSlot] = locatedIndex;
+			}
+			destroyItems(items, distinctCount, distinctCount + 1);
+		}
+	}
+	return canRemoveItem;
+}
+
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::clear()
+{
+	for (int i = 0; i < tableSize; i++)
+		table[i] = -1;
+	destroyItems(items, 0, distinctCount);
+	distinctCount = 0;
+	itemCount = 0;
+}
+
+template<typename ItemType, class Hash>
+bool CountingBag<ItemType, Hash>::contains(const ItemType& anEntry) const
+{
+	return (table[findSlot(anEntry)] != -1);
+}
+
+template<typename ItemType, class Hash>
+int CountingBag<ItemType, Hash>::getFrequencyOf(const ItemType& anEntry) const
+{
+	int slot = findSlot(anEntry);
+	return (table[slot] == -1) ? 0 : counts[table[slot]];
+}
+
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::print() const
+{
+	for (int i = 0; i < distinctCount; i++)
+		cout << items[i] << "(" << counts[i] << ") ";
+	cout << endl;
+}
+
+template<typename ItemType, class Hash>
+ArrayBag<ItemType> CountingBag<ItemType, Hash>::toArrayBag() const
+{
+	ArrayBag<ItemType> aBag;
+	aBag.reserve(itemCount); // allocate once for every copy
+	for (int i = 0; i < distinctCount; i++)
+	{
+		for (int j = 0; j < counts[i]; j++)
+			new (&aBag.items[aBag.itemCount++]) ItemType(items[i]);
+	}
+	return aBag;
+}
+
+template<typename ItemType, class Hash>
+typename CountingBag<ItemType, Hash>::const_iterator CountingBag<ItemType, Hash>::begin() const
+{
+	return const_iterator(items, counts);
+}
+
+template<typename ItemType, class Hash>
+typename CountingBag<ItemType, Hash>::const_iterator CountingBag<ItemType, Hash>::end() const
+{
+	return const_iterator(items + distinctCount, counts + distinctCount);
+}
+
+template<typename ItemType, class Hash>
+const CountingBag<ItemType, Hash>& CountingBag<ItemType, Hash>::operator=(const CountingBag<ItemType, Hash>& aBag)
+{
+	if (this != &aBag) {
+		releaseAll();
+		copyFrom(aBag);
+	}
+	return *this;
+}
+
+template<typename ItemType, class Hash>
+const CountingBag<ItemType, Hash>& CountingBag<ItemType, Hash>::operator=(CountingBag<ItemType, Hash>&& aBag)
+{
+	if (this != &aBag) {
+		releaseAll();
+		moveFrom(aBag);
+	}
+	return *this;
+}
+
+// private
+template<typename ItemType, class Hash>
+int CountingBag<ItemType, Hash>::findSlot(const ItemType& target) const
+{
+	int mask = tableSize - 1;
+	int i = static_cast<int>(hasher(target) & mask);
+	while (table[i] != -1 && !(items[table[i]] == target))
+		i = (i + 1) & mask; // linear probing
+	return i;
+}
+
+// private
+// Backward-shift deletion, as in HashedBag::eraseEntry().
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::eraseSlot(int slot)
+{
+	int mask = tableSize - 1;
+	int hole = slot;
+	int i = (hole + 1) & mask;
+	while (table[i] != -1)
+	{
+		int home = static_cast<int>(hasher(items[table[i]]) & mask);
+		bool homeInRange = (hole <= i) ? (hole < home && home <= i)
+									   : (hole < home || home <= i);
+		if (!homeInRange)
+		{
+			table[hole] = table[i];
+			hole = i;
+		}
+		i = (i + 1) & mask;
+	}
+	table[hole] = -1;
+}
+
+// private
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::rehash(int newTableSize)
+{
+	freeItems(table);
+	table = allocateItems<int>(newTableSize);
+	tableSize = newTableSize;
+	for (int i = 0; i < tableSize; i++)
+		table[i] = -1;
+	for (int i = 0; i < distinctCount; i++)
+		table[findSlot(items[i])] = i;
+}
+
+// private
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::initEmpty()
+{
+	distinctCount = 0;
+	maxItems = DEFAULT_CAPACITY;
+	itemCount = 0;
+	tableSize = DEFAULT_TABLE_SIZE;
+	items = allocateItems<ItemType>(maxItems);
+	counts = allocateItems<int>(maxItems);
+	table = allocateItems<int>(tableSize);
+	for (int i = 0; i < tableSize; i++)
+		table[i] = -1;
+}
+
+// private
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::releaseAll()
+{
+	destroyItems(items, 0, distinctCount);
+	freeItems(items);
+	freeItems(counts);
+	freeItems(table);
+}
+
+// private
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::copyFrom(const CountingBag<ItemType, Hash>& aBag)
+{
+	distinctCount = aBag.distinctCount;
+	maxItems = aBag.maxItems;
+	itemCount = aBag.itemCount;
+	tableSize = aBag.tableSize;
+	hasher = aBag.hasher;
+	items = allocateItems<ItemType>(maxItems);
+	counts = allocateItems<int>(maxItems);
+	copyItems(items, aBag.items, distinctCount);
+	copyItems(counts, aBag.counts, distinctCount);
+	table = allocateItems<int>(tableSize);
+	copyItems(table, aBag.table, tableSize);
+}
+
+// private
+// Takes aBag's arrays and leaves aBag as a new empty bag.
+template<typename ItemType, class Hash>
+void CountingBag<ItemType, Hash>::moveFrom(CountingBag<ItemType, Hash>& aBag)
+{
+	items = aBag.items;
+	counts = aBag.counts;
+	distinctCount = aBag.distinctCount;
+	maxItems = aBag.maxItems;
+	itemCount = aBag.itemCount;
+	table = aBag.table;
+	tableSize = aBag.tableSize;
+	hasher = move(aBag.hasher);
+	aBag.initEmpty();
+}
+#endif // !_BAG_H_
@@ -0,0 +1,938 @@
+// ConcurrentQueue.h
+// Queues that several threads can use at once: lock-free ones, and BlockingQueue, which waits.
+#ifndef _CONCURRENT_QUEUE_H_
+#define _CONCURRENT_QUEUE_H_
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "ArrayStorage.h"
+#include "HazardPointer.h"
+#include "Queue.h"
+using namespace std;
+
+// Bounded multi-producer multi-consumer queue (Dmitry Vyukov's design).
+// Every slot has a sequence number that says whose turn it is: a producer may fill slot i
+// when its sequence is the enqueue position, a consumer may empty it when the sequence is
+// that position + 1. Claiming a position is one compare-and-swap on the head or the tail,
+// which sit on cache lines of their own; a full or empty queue makes try_enqueue / try_dequeue
+// return false at once instead of waiting. The capacity is fixed (rounded up to a power of 2, at most 2^30).
+// ItemType's move constructor must not throw: a claimed slot has to be filled.
+template<class ItemType>
+class ConcurrentRingQueue
+{
+private:
+	static const int CACHE_LINE = 64;
+	static const int MAX_CAPACITY = 1 << 30; // the biggest power of 2 an int holds
+	struct Slot
+	{
+		atomic<size_t> sequence;
+		alignas(ItemType) unsigned char storage[sizeof(ItemType)]; // the item, while the slot is full
+		ItemType* item() { return reinterpret_cast<ItemType*>(storage); }
+	};
+
+	Slot* slots;
+	size_t mask; // capacity - 1
+	alignas(CACHE_LINE) atomic<size_t> enqueuePos; // next position for a producer
+	alignas(CACHE_LINE) atomic<size_t> dequeuePos; // next position for a consumer
+	char padding[CACHE_LINE - sizeof(atomic<size_t>)]; // keeps whatever follows off dequeuePos' line
+	Slot* claimForEnqueue();
+public:
+	explicit ConcurrentRingQueue(int capacity);
+	ConcurrentRingQueue(const ConcurrentRingQueue<ItemType>& aQueue) = delete;
+	~ConcurrentRingQueue();
+	bool isEmpty() const; // only a hint while other threads are using the queue
+	int getCapacity() const;
+	bool try_enqueue(const ItemType& newEntry); // false if the queue is full
+	bool try_enqueue(ItemType&& newEntry);
+	template<class... Args>
+	bool try_emplace(Args&&... args);
+	bool try_dequeue(ItemType& frontEntry); // moves the front into frontEntry; false if the queue is empty
+	const ConcurrentRingQueue<ItemType>& operator=(const ConcurrentRingQueue<ItemType>& aQueue) = delete;
+};
+
+// Bounded queue between exactly one producer thread and one consumer thread.
+// It keeps ArrayQueue's circular front / back scheme, with each index written by one side only:
+// the producer publishes back with a release store and the consumer reads it with an acquire
+// load (front the other way round), so neither side ever waits or retries.
+// Each side also keeps its last look at the other side's index and reads the shared one again
+// only when that look says the queue is full (or empty); most calls touch no line of the other side.
+// enqueueBulk / dequeueBulk move many items for one store of the index.
+// The capacity is fixed (rounded up to a power of 2, at most 2^30).
+template<class ItemType>
+class SPSC_RingQueue
+{
+private:
+	static const int CACHE_LINE = 64;
+	static const int MAX_CAPACITY = 1 << 30; // the biggest power of 2 an int holds
+	ItemType* items; // circular; only front .. back - 1 are constructed
+	size_t mask;     // capacity - 1
+	alignas(CACHE_LINE) atomic<size_t> back; // written by the producer
+	size_t cachedFront;                      // the producer's last look at front
+	alignas(CACHE_LINE) atomic<size_t> front; // written by the consumer
+	size_t cachedBack;                        // the consumer's last look at back
+	char padding[CACHE_LINE - sizeof(atomic<size_t>) - sizeof(size_t)];
+	size_t roomFor(size_t backPos, size_t wanted);  // producer side: free slots, at most wanted
+	size_t readyFor(size_t frontPos, size_t wanted); // consumer side: full slots, at most wanted
+public:
+	explicit SPSC_RingQueue(int capacity);
+	SPSC_RingQueue(const SPSC_RingQueue<ItemType>& aQueue) = delete;
+	~SPSC_RingQueue();
+	bool isEmpty() const; // only a hint while the other side is running
+	int getCapacity() const;
+	// producer side
+	bool try_enqueue(const ItemType& newEntry); // false if the queue is full
+	bool try_enqueue(ItemType&& newEntry);
+	template<class... Args>
+	bool try_emplace(Args&&... args);
+	template<class InputIterator>
+	int enqueueBulk(InputIterator first, InputIterator last); // enqueues as many as fit, in order; returns how many
+	// consumer side
+	bool try_dequeue(ItemType& frontEntry); // false if the queue is empty
+	template<class OutputIterator>
+	int dequeueBulk(OutputIterator result, int maxCount); // moves up to maxCount items out; returns how many
+	const SPSC_RingQueue<ItemType>& operator=(const SPSC_RingQueue<ItemType>& aQueue) = delete;
+};
+
+// Unbounded lock-free queue (Michael and Scott) for any number of producers and consumers.
+// Like LinkedQueue it is a chain from frontPtr to backPtr, but frontPtr always points to a dummy
+// node whose next is the real front: enqueue only swings backPtr and dequeue only frontPtr, each
+// with a compare-and-swap, and a thread that finds backPtr lagging moves it on before retrying.
+// A dequeued node is retired through HazardPointers, so it is never deleted while another
+// thread may still read it.
+// peekFront() copies the front while a concurrent dequeue may be moving it out; use it only
+// when no other thread dequeues, and try_dequeue() otherwise.
+template<class ItemType>
+class ConcurrentLinkedQueue : public QueueInterface<ItemType>
+{
+private:
+	static const int CACHE_LINE = 64;
+	struct QueueNode
+	{
+		atomic<QueueNode*> next;
+		alignas(ItemType) unsigned char storage[sizeof(ItemType)]; // the item; empty in the dummy
+		ItemType* item() { return reinterpret_cast<ItemType*>(storage); }
+		QueueNode() : next(nullptr) {}
+	};
+
+	alignas(CACHE_LINE) atomic<QueueNode*> frontPtr; // the dummy
+	alignas(CACHE_LINE) atomic<QueueNode*> backPtr;
+	char padding[CACHE_LINE - sizeof(atomic<QueueNode*>)];
+	void link(QueueNode* newNodePtr);
+	bool unlinkFront(ItemType* frontEntry); // moves the front into *frontEntry, or just destroys it
+public:
+	ConcurrentLinkedQueue();
+	ConcurrentLinkedQueue(const ConcurrentLinkedQueue<ItemType>& aQueue) = delete;
+	~ConcurrentLinkedQueue();
+	bool isEmpty() const; // only a hint while other threads are using the queue
+	bool enqueue(const ItemType& newEntry);
+	bool enqueue(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	bool dequeue();
+	bool try_dequeue(ItemType& frontEntry); // false if the queue is empty
+	ItemType peekFront() const;
+	const ConcurrentLinkedQueue<ItemType>& operator=(const ConcurrentLinkedQueue<ItemType>& aQueue) = delete;
+};
+
+// Bounded queue whose enqueue waits while it is full and whose dequeue waits while it is empty
+// (or, in the ...For versions, until a timeout). One mutex guards an ArrayQueue-style circular
+// array; a thread is woken only when some thread is actually waiting for the change it made.
+// enqueueMany / drainTo move many items per lock and per wakeup, so a consumer that wakes up
+// takes all that has piled up instead of one item each time.
+// close() ends it: enqueue fails from then on, and dequeue fails once the queue is empty.
+template<class ItemType>
+class BlockingQueue : public QueueInterface<ItemType>
+{
+private:
+	ItemType* items; // circular; only front .. front + itemCount - 1 are constructed
+	int front;
+	int itemCount;
+	int maxItems;
+	bool closed;
+	int producersWaiting;
+	int consumersWaiting;
+	mutable mutex queueMutex;
+	condition_variable notFull;
+	condition_variable notEmpty;
+	bool waitForRoom(unique_lock<mutex>& lock);  // false if closed
+	bool waitForItem(unique_lock<mutex>& lock);  // false if closed and empty
+	template<class Clock, class Duration>
+	bool waitForRoomUntil(unique_lock<mutex>& lock, const chrono::time_point<Clock, Duration>& deadline);
+	template<class Clock, class Duration>
+	bool waitForItemUntil(unique_lock<mutex>& lock, const chrono::time_point<Clock, Duration>& deadline);
+	template<class... Args>
+	void pushBack(Args&&... args);       // there is room; lock held
+	void popFront(ItemType* frontEntry); // there is an item; lock held
+	void wakeConsumers(int addedCount);  // lock held
+	void wakeProducers(int removedCount); // lock held
+public:
+	explicit BlockingQueue(int capacity);
+	BlockingQueue(const BlockingQueue<ItemType>& aQueue) = delete;
+	~BlockingQueue();
+	bool isEmpty() const;
+	int getNumberOfItems() const;
+	int getCapacity() const;
+	bool isClosed() const;
+	bool enqueue(const ItemType& newEntry); // waits for room; false if the queue is closed
+	bool enqueue(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class Rep, class Period>
+	bool enqueueFor(const ItemType& newEntry, const chrono::duration<Rep, Period>& timeout); // false on timeout too
+	template<class Rep, class Period>
+	bool enqueueFor(ItemType&& newEntry, const chrono::duration<Rep, Period>& timeout);
+	template<class InputIterator>
+	int enqueueMany(InputIterator first, InputIterator last); // waits for room as needed; returns how many got in before a close
+	bool dequeue(); // waits for an item; false if the queue is closed and empty
+	bool dequeue(ItemType& frontEntry);
+	template<class Rep, class Period>
+	bool dequeueFor(ItemType& frontEntry, const chrono::duration<Rep, Period>& timeout); // false on timeout too
+	template<class OutputIterator>
+	int drainTo(OutputIterator result, int maxCount); // waits for an item, then moves out up to maxCount; 0 once closed and empty
+	ItemType peekFront() const; // does not wait
+	void close(); // wakes every waiting thread
+	const BlockingQueue<ItemType>& operator=(const BlockingQueue<ItemType>& aQueue) = delete;
+};
+
+//=================================================================================================
+// ConcurrentRingQueue
+//=================================================================================================
+template<class ItemType>
+ConcurrentRingQueue<ItemType>::ConcurrentRingQueue(int capacity) : enqueuePos(0), dequeuePos(0)
+{
+	if(capacity < 1)
+		throw logic_error("Precondition Violated Exception: ConcurrentRingQueue needs a capacity of at least 1.\n");
+	if(capacity > MAX_CAPACITY)
+		throw logic_error("Precondition Violated Exception: ConcurrentRingQueue allows a capacity of at most 2^30.\n");
+
+	size_t roundedCapacity = 1;
+	while(roundedCapacity < static_cast<size_t>(capacity))
+		roundedCapacity *= 2;
+	mask = roundedCapacity - 1;
+	slots = allocateAlignedItems<Slot>(static_cast<int>(roundedCapacity), CACHE_LINE);
+	for(size_t i = 0; i < roundedCapacity; i++)
+		new (&slots[i].sequence) atomic<size_t>(i);
+}
+
+template<class ItemType>
+ConcurrentRingQueue<ItemType>::~ConcurrentRingQueue()
+{
+	// no other thread uses the queue any more: the full slots are dequeuePos .. enqueuePos - 1
+	size_t last = enqueuePos.load(memory_order_relaxed);
+	for(size_t pos = dequeuePos.load(memory_order_relaxed); pos != last; pos++)
+		slots[pos & mask].item()->~ItemType();
+	freeAlignedItems(slots);
+}
+
+template<class ItemType>
+bool ConcurrentRingQueue<ItemType>::isEmpty() const
+{
+	return (dequeuePos.load(memory_order_acquire) >= enqueuePos.load(memory_order_acquire));
+}
+
+template<class ItemType>
+int ConcurrentRingQueue<ItemType>::getCapacity() const
+{
+	return static_cast<int>(mask + 1);
+}
+
+template<class ItemType>
+bool ConcurrentRingQueue<ItemType>::try_enqueue(const ItemType& newEntry)
+{
+	return try_enqueue(ItemType(newEntry)); // copies first: a claimed slot must always be filled
+}
+
+template<class ItemType>
+bool ConcurrentRingQueue<ItemType>::try_enqueue(ItemType&& newEntry)
+{
+	Slot* slotPtr = claimForEnqueue();
+	if(slotPtr == nullptr)
+		return false;
+
+	size_t pos = slotPtr->sequence.load(memory_order_relaxed);
+	new (slotPtr->item()) ItemType(move(newEntry));
+	slotPtr->sequence.store(pos + 1, memory_order_release); // hands the slot to the consumers
+	return true;
+}
+
+template<class ItemType>
+template<class... Args>
+bool ConcurrentRingQueue<ItemType>::try_emplace(Args&&... args)
+{
+	return try_enqueue(ItemType(forward<Args>(args)...));
+}
+
+template<class ItemType>
+bool ConcurrentRingQueue<ItemType>::try_dequeue(ItemType& frontEntry)
+{
+	size_t pos = dequeuePos.load(memory_order_relaxed);
+	Slot* slotPtr;
+	while(true)
+	{
+		slotPtr = &slots[pos & mask];
+		size_t sequence = slotPtr->sequence.load(memory_order_acquire);
+		ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos + 1);
+		if(difference == 0) // filled for this position: try to take it
+		{
+			if(dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+				break;
+		}
+		else if(difference < 0) // not filled yet: empty
+			return false;
+		else // another consumer took it first
+			pos = dequeuePos.load(memory_order_relaxed);
+	}
+
+	frontEntry = move(*slotPtr->item());
+	slotPtr->item()->~ItemType();
+	slotPtr->sequence.store(pos + mask + 1, memory_order_release); // free for the producer one lap later
+	return true;
+}
+
+// private member function of ConcurrentRingQueue
+// Claims the slot for the next enqueue position, or returns nullptr when the queue is full.
+// The slot's sequence is left as the claimed position.
+template<class ItemType>
+typename ConcurrentRingQueue<ItemType>::Slot* ConcurrentRingQueue<ItemType>::claimForEnqueue()
+{
+	size_t pos = enqueuePos.load(memory_order_relaxed);
+	while(true)
+	{
+		Slot* slotPtr = &slots[pos & mask];
+		size_t sequence = slotPtr->sequence.load(memory_order_acquire);
+		ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+		if(difference == 0) // free for this position: try to claim it
+		{
+			if(enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+				return slotPtr;
+		}
+		else if(difference < 0) // still holds the item of the previous lap: full
+			return nullptr;
+		else // another producer claimed it first
+			pos = enqueuePos.load(memory_order_relaxed);
+	}
+}
+
+//=================================================================================================
+// SPSC_RingQueue
+//=================================================================================================
+template<class ItemType>
+SPSC_RingQueue<ItemType>::SPSC_RingQueue(int capacity) : back(0), cachedFront(0), front(0), cachedBack(0)
+{
+	if(capacity < 1)
+		throw logic_error("Precondition Violated Exception: SPSC_RingQueue needs a capacity of at least 1.\n");
+	if(capacity > MAX_CAPACITY)
+		throw logic_error("Precondition Violated Exception: SPSC_RingQueue allows a capacity of at most 2^30.\n");
+
+	size_t roundedCapacity = 1;
+	while(roundedCapacity < static_cast<size_t>(capacity))
+		roundedCapacity *= 2;
+	mask = roundedCapacity - 1;
+	items = allocateAlignedItems<ItemType>(static_cast<int>(roundedCapacity), CACHE_LINE);
+}
+
+template<class ItemType>
+SPSC_RingQueue<ItemType>::~SPSC_RingQueue()
+{
+	size_t last = back.load(memory_order_relaxed);
+	for(size_t pos = front.load(memory_order_relaxed); pos != last; pos++)
+		items[pos & mask].~ItemType();
+	freeAlignedItems(items);
+}
+
+template<class ItemType>
+bool SPSC_RingQueue<ItemType>::isEmpty() const
+{
+	return (front.load(memory_order_acquire) == back.load(memory_order_acquire));
+}
+
+template<class ItemType>
+int SPSC_RingQueue<ItemType>::getCapacity() const
+{
+	return static_cast<int>(mask + 1);
+}
+
+template<class ItemType>
+bool SPSC_RingQueue<ItemType>::try_enqueue(const ItemType& newEntry)
+{
+	return try_emplace(newEntry);
+}
+
+template<class ItemType>
+bool SPSC_RingQueue<ItemType>::try_enqueue(ItemType&& newEntry)
+{
+	return try_emplace(move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool SPSC_RingQueue<ItemType>::try_emplace(Args&&... args)
+{
+	size_t backPos = back.load(memory_order_relaxed);
+	if(roomFor(backPos, 1) == 0)
+		return false;
+
+	new (&items[backPos & mask]) ItemType(forward<Args>(args)...);
+	back.store(backPos + 1, memory_order_release); // hands the item to the consumer
+	return true;
+}
+
+template<class ItemType>
+template<class InputIterator>
+int SPSC_RingQueue<ItemType>::enqueueBulk(InputIterator first, InputIterator last)
+{
+	size_t backPos = back.load(memory_order_relaxed);
+	int count = rangeLength(first, last);
+	size_t room = roomFor(backPos, (count >= 0) ? static_cast<size_t>(count) : mask + 1);
+	size_t builtCount = 0;
+	try
+	{
+		for(; builtCount < room && first != last; ++first)
+		{
+			new (&items[(backPos + builtCount) & mask]) ItemType(*first);
+			builtCount++;
+		}
+	}
+	catch(...)
+	{
+		back.store(backPos + builtCount, memory_order_release); // the ones built are in
+		throw;
+	}
+	back.store(backPos + builtCount, memory_order_release);
+	return static_cast<int>(builtCount);
+}
+
+template<class ItemType>
+bool SPSC_RingQueue<ItemType>::try_dequeue(ItemType& frontEntry)
+{
+	size_t frontPos = front.load(memory_order_relaxed);
+	if(readyFor(frontPos, 1) == 0)
+		return false;
+
+	ItemType& frontItem = items[frontPos & mask];
+	frontEntry = move(frontItem);
+	frontItem.~ItemType();
+	front.store(frontPos + 1, memory_order_release); // gives the slot back to the producer
+	return true;
+}
+
+template<class ItemType>
+template<class OutputIterator>
+int SPSC_RingQueue<ItemType>::dequeueBulk(OutputIterator result, int maxCount)
+{
+	if(maxCount <= 0)
+		return 0;
+
+	size_t frontPos = front.load(memory_order_relaxed);
+	size_t ready = readyFor(frontPos, static_cast<size_t>(maxCount));
+	for(size_t i = 0; i < ready; i++)
+	{
+		ItemType& frontItem = items[(frontPos + i) & mask];
+		*result = move(frontItem);
+		++result;
+		frontItem.~ItemType();
+	}
+	front.store(frontPos + ready, memory_order_release);
+	return static_cast<int>(ready);
+}
+
+// private member function of SPSC_RingQueue
+template<class ItemType>
+size_t SPSC_RingQueue<ItemType>::roomFor(size_t backPos, size_t wanted)
+{
+	size_t room = mask + 1 - (backPos - cachedFront);
+	if(room < wanted) // the consumer may have moved on since the last look
+	{
+		cachedFront = front.load(memory_order_acquire);
+		room = mask + 1 - (backPos - cachedFront);
+	}
+	return (room < wanted) ? room : wanted;
+}
+
+// private member function of SPSC_RingQueue
+template<class ItemType>
+size_t SPSC_RingQueue<ItemType>::readyFor(size_t frontPos, size_t wanted)
+{
+	size_t ready = cachedBack - frontPos;
+	if(ready < wanted)
+	{
+		cachedBack = back.load(memory_order_acquire);
+		ready = cachedBack - frontPos;
+	}
+	return (ready < wanted) ? ready : wanted;
+}
+
+//=================================================================================================
+// ConcurrentLinkedQueue
+//=================================================================================================
+template<class ItemType>
+ConcurrentLinkedQueue<ItemType>::ConcurrentLinkedQueue()
+{
+	QueueNode* dummyPtr = new QueueNode;
+	frontPtr.store(dummyPtr, memory_order_relaxed);
+	backPtr.store(dummyPtr, memory_order_relaxed);
+}
+
+template<class ItemType>
+ConcurrentLinkedQueue<ItemType>::~ConcurrentLinkedQueue()
+{
+	// no other thread uses the queue any more; only the nodes after the dummy hold items
+	QueueNode* curPtr = frontPtr.load(memory_order_relaxed);
+	QueueNode* nextPtr = curPtr->next.load(memory_order_relaxed);
+	delete curPtr;
+	while(nextPtr != nullptr)
+	{
+		curPtr = nextPtr;
+		nextPtr = curPtr->next.load(memory_order_relaxed);
+		curPtr->item()->~ItemType();
+		delete curPtr;
+	}
+}
+
+template<class ItemType>
+bool ConcurrentLinkedQueue<ItemType>::isEmpty() const
+{
+	QueueNode* dummyPtr = HazardPointers::protect(0, frontPtr);
+	bool empty = (dummyPtr->next.load(memory_order_acquire) == nullptr);
+	HazardPointers::clear(0);
+	return empty;
+}
+
+template<class ItemType>
+bool ConcurrentLinkedQueue<ItemType>::enqueue(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType>
+bool ConcurrentLinkedQueue<ItemType>::enqueue(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool ConcurrentLinkedQueue<ItemType>::emplace(Args&&... args)
+{
+	QueueNode* newNodePtr = new QueueNode;
+	try
+	{
+		new (newNodePtr->item()) ItemType(forward<Args>(args)...);
+	}
+	catch(...)
+	{
+		delete newNodePtr;
+		throw;
+	}
+	link(newNodePtr);
+	return true;
+}
+
+template<class ItemType>
+bool ConcurrentLinkedQueue<ItemType>::dequeue()
+{
+	return unlinkFront(nullptr);
+}
+
+template<class ItemType>
+bool ConcurrentLinkedQueue<ItemType>::try_dequeue(ItemType& frontEntry)
+{
+	return unlinkFront(&frontEntry);
+}
+
+template<class ItemType>
+ItemType ConcurrentLinkedQueue<ItemType>::peekFront() const
+{
+	QueueNode* dummyPtr = HazardPointers::protect(0, frontPtr);
+	QueueNode* frontNodePtr = HazardPointers::protect(1, dummyPtr->next);
+	if(frontNodePtr == nullptr)
+	{
+		HazardPointers::clearAll();
+		throw logic_error("Precondition Violated Exception: peekFront() called with an empty queue.\n");
+	}
+
+	ItemType frontEntry(*frontNodePtr->item());
+	HazardPointers::clearAll();
+	return frontEntry;
+}
+
+// private member function of ConcurrentLinkedQueue
+template<class ItemType>
+void ConcurrentLinkedQueue<ItemType>::link(QueueNode* newNodePtr)
+{
+	while(true)
+	{
+		QueueNode* lastPtr = HazardPointers::protect(0, backPtr);
+		QueueNode* nextPtr = lastPtr->next.load(memory_order_acquire);
+		if(nextPtr != nullptr) // backPtr lags behind: help it on
+		{
+			backPtr.compare_exchange_weak(lastPtr, nextPtr, memory_order_release, memory_order_relaxed);
+			continue;
+		}
+		if(lastPtr->next.compare_exchange_weak(nextPtr, newNodePtr, memory_order_release, memory_order_relaxed))
+		{
+			// may fail if another thread has already helped; either way backPtr moves on
+			backPtr.compare_exchange_strong(lastPtr, newNodePtr, memory_order_release, memory_order_relaxed);
+			break;
+		}
+	}
+	HazardPointers::clear(0);
+}
+
+// private member function of ConcurrentLinkedQueue
+// The node after the dummy becomes the new dummy once its item is taken out, and the old
+// dummy is retired.
+template<class ItemType>
+bool ConcurrentLinkedQueue<ItemType>::unlinkFront(ItemType* frontEntry)
+{
+	QueueNode* dummyPtr;
+	QueueNode* nextPtr;
+	while(true)
+	{
+		dummyPtr = HazardPointers::protect(0, frontPtr);
+		nextPtr = HazardPointers::protect(1, dummyPtr->next);
+		if(dummyPtr != frontPtr.load(memory_order_acquire)) // dequeued meanwhile: nextPtr may be stale
+			continue;
+		if(nextPtr == nullptr)
+		{
+			HazardPointers::clearAll();
+			return false;
+		}
+
+		QueueNode* lastPtr = backPtr.load(memory_order_acquire);
+		if(dummyPtr == lastPtr) // backPtr still on the dummy: move it on first
+		{
+			backPtr.compare_exchange_weak(lastPtr, nextPtr, memory_order_release, memory_order_relaxed);
+			continue;
+		}
+		if(frontPtr.compare_exchange_weak(dummyPtr, nextPtr, memory_order_acq_rel, memory_order_relaxed))
+			break;
+	}
+
+	// only this thread reaches nextPtr's item; the hazard keeps nextPtr alive meanwhile
+	if(frontEntry != nullptr)
+		*frontEntry = move(*nextPtr->item());
+	nextPtr->item()->~ItemType();
+	HazardPointers::clearAll();
+	HazardPointers::retire(dummyPtr);
+	return true;
+}
+
+//=================================================================================================
+// BlockingQueue
+//=================================================================================================
+template<class ItemType>
+BlockingQueue<ItemType>::BlockingQueue(int capacity)
+	: front(0), itemCount(0), maxItems(capacity), closed(false), producersWaiting(0), consumersWaiting(0)
+{
+	if(capacity < 1)
+		throw logic_error("Precondition Violated Exception: BlockingQueue needs a capacity of at least 1.\n");
+
+	items = allocateItems<ItemType>(maxItems);
+}
+
+template<class ItemType>
+BlockingQueue<ItemType>::~BlockingQueue()
+{
+	while(itemCount > 0)
+		popFront(nullptr);
+	freeItems(items);
+}
+
+template<class ItemType>
+bool BlockingQueue<ItemType>::isEmpty() const
+{
+	lock_guard<mutex> lock(queueMutex);
+	return (itemCount == 0);
+}
+
+template<class ItemType>
+int BlockingQueue<ItemType>::getNumberOfItems() const
+{
+	lock_guard<mutex> lock(queueMutex);
+	return itemCount;
+}
+
+template<class ItemType>
+int BlockingQueue<ItemType>::getCapacity() const
+{
+	return maxItems;
+}
+
+template<class ItemType>
+bool BlockingQueue<ItemType>::isClosed() const
+{
+	lock_guard<mutex> lock(queueMutex);
+	return closed;
+}
+
+template<class ItemType>
+bool BlockingQueue<ItemType>::enqueue(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType>
+bool BlockingQueue<ItemType>::enqueue(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool BlockingQueue<ItemType>::emplace(Args&&... args)
+{
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForRoom(lock))
+		return false;
+
+	pushBack(forward<Args>(args)...);
+	wakeConsumers(1);
+	return true;
+}
+
+template<class ItemType>
+template<class Rep, class Period>
+bool BlockingQueue<ItemType>::enqueueFor(const ItemType& newEntry, const chrono::duration<Rep, Period>& timeout)
+{
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForRoomUntil(lock, chrono::steady_clock::now() + timeout))
+		return false;
+
+	pushBack(newEntry);
+	wakeConsumers(1);
+	return true;
+}
+
+template<class ItemType>
+template<class Rep, class Period>
+bool BlockingQueue<ItemType>::enqueueFor(ItemType&& newEntry, const chrono::duration<Rep, Period>& timeout)
+{
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForRoomUntil(lock, chrono::steady_clock::now() + timeout))
+		return false;
+
+	pushBack(move(newEntry));
+	wakeConsumers(1);
+	return true;
+}
+
+template<class ItemType>
+template<class InputIterator>
+int BlockingQueue<ItemType>::enqueueMany(InputIterator first, InputIterator last)
+{
+	int enqueuedCount = 0;
+	unique_lock<mutex> lock(queueMutex);
+	while(first != last)
+	{
+		if(!waitForRoom(lock))
+			break;
+		int addedCount = 0;
+		for(; itemCount < maxItems && first != last; ++first) // as many as fit under this lock
+		{
+			pushBack(*first);
+			addedCount++;
+		}
+		enqueuedCount += addedCount;
+		wakeConsumers(addedCount);
+	}
+	return enqueuedCount;
+}
+
+template<class ItemType>
+bool BlockingQueue<ItemType>::dequeue()
+{
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForItem(lock))
+		return false;
+
+	popFront(nullptr);
+	wakeProducers(1);
+	return true;
+}
+
+template<class ItemType>
+bool BlockingQueue<ItemType>::dequeue(ItemType& frontEntry)
+{
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForItem(lock))
+		return false;
+
+	popFront(&frontEntry);
+	wakeProducers(1);
+	return true;
+}
+
+template<class ItemType>
+template<class Rep, class Period>
+bool BlockingQueue<ItemType>::dequeueFor(ItemType& frontEntry, const chrono::duration<Rep, Period>& timeout)
+{
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForItemUntil(lock, chrono::steady_clock::now() + timeout))
+		return false;
+
+	popFront(&frontEntry);
+	wakeProducers(1);
+	return true;
+}
+
+template<class ItemType>
+template<class OutputIterator>
+int BlockingQueue<ItemType>::drainTo(OutputIterator result, int maxCount)
+{
+	if(maxCount <= 0)
+		return 0;
+
+	unique_lock<mutex> lock(queueMutex);
+	if(!waitForItem(lock))
+		return 0;
+
+	int removedCount = (itemCount < maxCount) ? itemCount : maxCount;
+	for(int i = 0; i < removedCount; i++)
+	{
+		*result = move(items[front]);
+		++result;
+		popFront(nullptr);
+	}
+	wakeProducers(removedCount);
+	return removedCount;
+}
+
+template<class ItemType>
+ItemType BlockingQueue<ItemType>::peekFront() const
+{
+	lock_guard<mutex> lock(queueMutex);
+	if(itemCount == 0)
+		throw logic_error("Precondition Violated Exception: peekFront() called with an empty queue.\n");
+
+	return items[front];
+}
+
+template<class ItemType>
+void BlockingQueue<ItemType>::close()
+{
+	lock_guard<mutex> lock(queueMutex);
+	closed = true;
+	notFull.notify_all();
+	notEmpty.notify_all();
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+bool BlockingQueue<ItemType>::waitForRoom(unique_lock<mutex>& lock)
+{
+	while(!closed && itemCount == maxItems)
+	{
+		producersWaiting++;
+		notFull.wait(lock);
+		producersWaiting--;
+	}
+	return !closed;
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+bool BlockingQueue<ItemType>::waitForItem(unique_lock<mutex>& lock)
+{
+	while(!closed && itemCount == 0)
+	{
+		consumersWaiting++;
+		notEmpty.wait(lock);
+		consumersWaiting--;
+	}
+	return (itemCount > 0);
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+template<class Clock, class Duration>
+bool BlockingQueue<ItemType>::waitForRoomUntil(unique_lock<mutex>& lock, const chrono::time_point<Clock, Duration>& deadline)
+{
+	while(!closed && itemCount == maxItems)
+	{
+		producersWaiting++;
+		cv_status status = notFull.wait_until(lock, deadline);
+		producersWaiting--;
+		if(status == cv_status::timeout)
+			break;
+	}
+	return (!closed && itemCount < maxItems);
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+template<class Clock, class Duration>
+bool BlockingQueue<ItemType>::waitForItemUntil(unique_lock<mutex>& lock, const chrono::time_point<Clock, Duration>& deadline)
+{
+	while(!closed && itemCount == 0)
+	{
+		consumersWaiting++;
+		cv_status status = notEmpty.wait_until(lock, deadline);
+		consumersWaiting--;
+		if(status == cv_status::timeout)
+			break;
+	}
+	return (itemCount > 0);
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+template<class... Args>
+void BlockingQueue<ItemType>::pushBack(Args&&... args)
+{
+	int back = front + itemCount;
+	if(back >= maxItems)
+		back -= maxItems;
+	new (&items[back]) ItemType(forward<Args>(args)...);
+	itemCount++;
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+void BlockingQueue<ItemType>::popFront(ItemType* frontEntry)
+{
+	if(frontEntry != nullptr)
+		*frontEntry = move(items[front]);
+	destroyItems(items, front, front + 1);
+	front++;
+	if(front == maxItems)
+		front = 0;
+	itemCount--;
+}
+
+// private member function of BlockingQueue
+// Wakes one consumer per item added, and none when nobody is waiting
+template<class ItemType>
+void BlockingQueue<ItemType>::wakeConsumers(int addedCount)
+{
+	if(consumersWaiting == 0 || addedCount == 0)
+		return;
+	if(addedCount >= consumersWaiting)
+		notEmpty.notify_all();
+	else
+	{
+		for(int i = 0; i < addedCount; i++)
+			notEmpty.notify_one();
+	}
+}
+
+// private member function of BlockingQueue
+template<class ItemType>
+void BlockingQueue<ItemType>::wakeProducers(int removedCount)
+{
+	if(producersWaiting == 0 || removedCount == 0)
+		return;
+	if(removedCount >= producersWaiting)
+		notFull.notify_all();
+	else
+	{
+		for(int i = 0; i < removedCount; i++)
+			notFull.notify_one();
+	}
+}
+#endif // !_CONCURRENT_QUEUE_H_
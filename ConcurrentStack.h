@@ -0,0 +1,225 @@
+// ConcurrentStack.h
+#ifndef _CONCURRENT_STACK_H_
+#define _CONCURRENT_STACK_H_
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+#include "HazardPointer.h"
+#include "Node.h"
+#include "Stack.h"
+using namespace std;
+
+// Lock-free stack (Treiber) for any number of threads: LinkedStack's chain of Nodes with
+// topPtr swung by a compare-and-swap in push and pop.
+// A popped node is retired through HazardPointers rather than deleted, so no thread can read a
+// freed node, and since a node's address cannot come back while a pop still holds it, the
+// compare-and-swap cannot be fooled by a top that was popped and pushed again (ABA).
+// With ELIMINATION_SLOTS > 0, a push or pop that loses the race on topPtr tries to meet an
+// opposite operation in one of that many slots instead: the pop takes the push's node directly
+// and neither touches topPtr. This pays off only when many threads hammer the same stack.
+// peek() copies the top while a concurrent pop may be moving it out; use it only when no
+// other thread pops, and try_pop() otherwise.
+template<class ItemType, int ELIMINATION_SLOTS = 0>
+class ConcurrentStack : public StackInterface<ItemType>
+{
+private:
+	static const int CACHE_LINE = 64;
+	static const int ELIMINATION_WAIT = 128; // how many times a waiting push looks at its slot
+	struct alignas(CACHE_LINE) EliminationSlot
+	{
+		atomic<Node<ItemType>*> offer; // a push's node waiting for a pop, or nullptr
+	};
+
+	alignas(CACHE_LINE) atomic<Node<ItemType>*> topPtr;
+	EliminationSlot eliminationSlots[(ELIMINATION_SLOTS > 0) ? ELIMINATION_SLOTS : 1];
+	void link(Node<ItemType>* newNodePtr);
+	bool unlinkTop(ItemType* topEntry); // moves the top into *topEntry, or just destroys it
+	bool eliminatePush(Node<ItemType>* newNodePtr);
+	Node<ItemType>* eliminatePop();
+	static int randomSlot();
+public:
+	ConcurrentStack();
+	ConcurrentStack(const ConcurrentStack<ItemType, ELIMINATION_SLOTS>& aStack) = delete;
+	~ConcurrentStack();
+	bool isEmpty() const; // only a hint while other threads are using the stack
+	bool push(const ItemType& newEntry);
+	bool push(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	bool pop();
+	bool try_pop(ItemType& topEntry); // false if the stack is empty
+	ItemType peek() const;
+	const ConcurrentStack<ItemType, ELIMINATION_SLOTS>& operator=(const ConcurrentStack<ItemType, ELIMINATION_SLOTS>& aStack) = delete;
+};
+
+//=================================================================================================
+// ConcurrentStack
+//=================================================================================================
+template<class ItemType, int ELIMINATION_SLOTS>
+ConcurrentStack<ItemType, ELIMINATION_SLOTS>::ConcurrentStack() : topPtr(nullptr)
+{
+	for(EliminationSlot& slot : eliminationSlots)
+		slot.offer.store(nullptr, memory_order_relaxed);
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+ConcurrentStack<ItemType, ELIMINATION_SLOTS>::~ConcurrentStack()
+{
+	// no other thread uses the stack any more
+	Node<ItemType>* curPtr = topPtr.load(memory_order_relaxed);
+	while(curPtr != nullptr)
+	{
+		Node<ItemType>* nodeToDeletePtr = curPtr;
+		curPtr = curPtr->next;
+		delete nodeToDeletePtr;
+	}
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::isEmpty() const
+{
+	return (topPtr.load(memory_order_acquire) == nullptr);
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::push(const ItemType& newEntry)
+{
+	link(new Node<ItemType>(newEntry));
+	return true;
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::push(ItemType&& newEntry)
+{
+	link(new Node<ItemType>(move(newEntry)));
+	return true;
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+template<class... Args>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::emplace(Args&&... args)
+{
+	link(new Node<ItemType>(nullptr, forward<Args>(args)...));
+	return true;
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::pop()
+{
+	return unlinkTop(nullptr);
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::try_pop(ItemType& topEntry)
+{
+	return unlinkTop(&topEntry);
+}
+
+template<class ItemType, int ELIMINATION_SLOTS>
+ItemType ConcurrentStack<ItemType, ELIMINATION_SLOTS>::peek() const
+{
+	Node<ItemType>* curTopPtr = HazardPointers::protect(0, topPtr);
+	if(curTopPtr == nullptr)
+	{
+		HazardPointers::clear(0);
+		throw logic_error("Precondition Violated Exception: peek() called with an empty stack.\n");
+	}
+
+	ItemType topEntry(curTopPtr->item);
+	HazardPointers::clear(0);
+	return topEntry;
+}
+
+// private member function of ConcurrentStack
+// newNodePtr->next is only written while the node is still ours, so readers need no atomics for it
+template<class ItemType, int ELIMINATION_SLOTS>
+void ConcurrentStack<ItemType, ELIMINATION_SLOTS>::link(Node<ItemType>* newNodePtr)
+{
+	newNodePtr->next = topPtr.load(memory_order_relaxed);
+	while(!topPtr.compare_exchange_weak(newNodePtr->next, newNodePtr, memory_order_release, memory_order_relaxed))
+	{
+		if(ELIMINATION_SLOTS > 0 && eliminatePush(newNodePtr))
+			return;
+	}
+}
+
+// private member function of ConcurrentStack
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::unlinkTop(ItemType* topEntry)
+{
+	Node<ItemType>* curTopPtr;
+	while(true)
+	{
+		curTopPtr = HazardPointers::protect(0, topPtr);
+		if(curTopPtr == nullptr)
+		{
+			HazardPointers::clear(0);
+			return false;
+		}
+		if(topPtr.compare_exchange_weak(curTopPtr, curTopPtr->next, memory_order_acquire, memory_order_relaxed))
+			break;
+
+		if(ELIMINATION_SLOTS > 0)
+		{
+			Node<ItemType>* offeredPtr = eliminatePop();
+			if(offeredPtr != nullptr) // a push's node, never in the stack: no hazard can hold it
+			{
+				HazardPointers::clear(0);
+				if(topEntry != nullptr)
+					*topEntry = move(offeredPtr->item);
+				delete offeredPtr;
+				return true;
+			}
+		}
+	}
+
+	HazardPointers::clear(0); // curTopPtr is out of the stack; nobody but us takes its item
+	if(topEntry != nullptr)
+		*topEntry = move(curTopPtr->item);
+	HazardPointers::retire(curTopPtr);
+	return true;
+}
+
+// private member function of ConcurrentStack
+// Leaves newNodePtr in a free slot for a while; true if a pop took it
+template<class ItemType, int ELIMINATION_SLOTS>
+bool ConcurrentStack<ItemType, ELIMINATION_SLOTS>::eliminatePush(Node<ItemType>* newNodePtr)
+{
+	atomic<Node<ItemType>*>& offer = eliminationSlots[randomSlot()].offer;
+	Node<ItemType>* emptyPtr = nullptr;
+	if(!offer.compare_exchange_strong(emptyPtr, newNodePtr, memory_order_release, memory_order_relaxed))
+		return false; // someone else is waiting there
+
+	for(int i = 0; i < ELIMINATION_WAIT; i++)
+	{
+		if(offer.load(memory_order_acquire) != newNodePtr)
+			return true;
+	}
+	Node<ItemType>* offeredPtr = newNodePtr;
+	return !offer.compare_exchange_strong(offeredPtr, nullptr, memory_order_acquire, memory_order_relaxed); // withdraw, unless taken just now
+}
+
+// private member function of ConcurrentStack
+// Takes a waiting push's node from a slot, or returns nullptr
+template<class ItemType, int ELIMINATION_SLOTS>
+Node<ItemType>* ConcurrentStack<ItemType, ELIMINATION_SLOTS>::eliminatePop()
+{
+	atomic<Node<ItemType>*>& offer = eliminationSlots[randomSlot()].offer;
+	Node<ItemType>* offeredPtr = offer.load(memory_order_acquire);
+	if(offeredPtr != nullptr && offer.compare_exchange_strong(offeredPtr, nullptr, memory_order_acquire, memory_order_relaxed))
+		return offeredPtr;
+	return nullptr;
+}
+
+// private member function of ConcurrentStack
+// xorshift on a per-thread state: spreads the threads over the slots with no shared counter
+template<class ItemType, int ELIMINATION_SLOTS>
+int ConcurrentStack<ItemType, ELIMINATION_SLOTS>::randomSlot()
+{
+	static thread_local unsigned state = 2463534242u ^ static_cast<unsigned>(reinterpret_cast<size_t>(&state));
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return static_cast<int>(state % ((ELIMINATION_SLOTS > 0) ? ELIMINATION_SLOTS : 1));
+}
+#endif // !_CONCURRENT_STACK_H_
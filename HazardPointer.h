@@ -0,0 +1,241 @@
+// HazardPointer.h
+// Safe memory reclamation for the lock-free DSs (Maged Michael's hazard pointers).
+// A thread that is about to read a shared node first publishes its address in one of its
+// hazard slots (protect()); a node taken out of a DS is handed to retire() instead of delete,
+// and is deleted only once no thread's hazard slot holds it.
+// Every thread gets a record with SLOTS_PER_THREAD slots the first time it calls in; the record
+// (and the nodes it still has to delete) goes to the next new thread when this one exits.
+#ifndef _HAZARD_POINTER_H_
+#define _HAZARD_POINTER_H_
+#include <atomic>
+#include <algorithm>
+#include <functional>
+#include "ArrayStorage.h"
+
+class HazardPointers
+{
+public:
+	static const int SLOTS_PER_THREAD = 2;
+
+	// Reads source into hazard slot slot of this thread and returns what was read;
+	// the node stays readable until the slot is cleared or used for another node.
+	template<class NodeType>
+	static NodeType* protect(int slot, const std::atomic<NodeType*>& source);
+	static void clear(int slot);
+	static void clearAll();
+	// nodePtr is no longer reachable from the DS: deletes it once it is not protected
+	template<class NodeType>
+	static void retire(NodeType* nodePtr);
+private:
+	static const int MIN_RETIRED = 64; // a scan is never started for fewer retired nodes
+	struct RetiredNode
+	{
+		void* nodePtr;
+		void (*deleteNode)(void*);
+	};
+	struct Record
+	{
+		std::atomic<void*> hazards[SLOTS_PER_THREAD];
+		std::atomic<bool> inUse;
+		Record* next; // the list of records only grows, so next never changes once set
+		RetiredNode* retired;
+		int retiredCount;
+		int maxRetired;
+	};
+	struct ThreadRecord // gives the record back when its thread exits
+	{
+		Record* recordPtr;
+		ThreadRecord();
+		~ThreadRecord();
+	};
+	struct Registry // the list of all records; frees them at exit
+	{
+		std::atomic<Record*> headPtr;
+		std::atomic<int> recordCount;
+		Registry();
+		~Registry();
+	};
+
+	static Registry& registry();
+	static Record* myRecord();
+	static Record* acquireRecord();
+	static void scan(Record* recordPtr);
+	template<class NodeType>
+	static void deleteNode(void* nodePtr);
+};
+
+//=================================================================================================
+// HazardPointers
+//=================================================================================================
+template<class NodeType>
+NodeType* HazardPointers::protect(int slot, const std::atomic<NodeType*>& source)
+{
+	std::atomic<void*>& hazard = myRecord()->hazards[slot];
+	NodeType* nodePtr = source.load(std::memory_order_relaxed);
+	while(true)
+	{
+		hazard.store(nodePtr); // seq_cst: seen by any scan that starts after the check below
+		NodeType* currentPtr = source.load(std::memory_order_acquire);
+		if(currentPtr == nodePtr) // still there, so not retired before the slot was set
+			return nodePtr;
+		nodePtr = currentPtr;
+	}
+}
+
+inline void HazardPointers::clear(int slot)
+{
+	myRecord()->hazards[slot].store(nullptr, std::memory_order_release);
+}
+
+inline void HazardPointers::clearAll()
+{
+	Record* recordPtr = myRecord();
+	for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+		recordPtr->hazards[slot].store(nullptr, std::memory_order_release);
+}
+
+template<class NodeType>
+void HazardPointers::retire(NodeType* nodePtr)
+{
+	Record* recordPtr = myRecord();
+	if(recordPtr->retiredCount == recordPtr->maxRetired)
+	{
+		int newCapacity = grownCapacity(recordPtr->maxRetired, MIN_RETIRED);
+		recordPtr->retired = reallocateItems(recordPtr->retired, recordPtr->retiredCount, newCapacity);
+		recordPtr->maxRetired = newCapacity;
+	}
+	RetiredNode& retiredNode = recordPtr->retired[recordPtr->retiredCount++];
+	retiredNode.nodePtr = nodePtr;
+	retiredNode.deleteNode = &HazardPointers::deleteNode<NodeType>;
+
+	// scanning costs O(threads); waiting for several per thread keeps it O(1) per node
+	int threshold = 2 * SLOTS_PER_THREAD * registry().recordCount.load(std::memory_order_relaxed);
+	if(threshold < MIN_RETIRED)
+		threshold = MIN_RETIRED;
+	if(recordPtr->retiredCount >= threshold)
+		scan(recordPtr);
+}
+
+// private member function of HazardPointers
+inline HazardPointers::Registry& HazardPointers::registry()
+{
+	static Registry theRegistry;
+	return theRegistry;
+}
+
+// private member function of HazardPointers
+inline HazardPointers::Record* HazardPointers::myRecord()
+{
+	registry(); // built before the thread_local below, so it is destroyed after it
+	static thread_local ThreadRecord threadRecord;
+	return threadRecord.recordPtr;
+}
+
+// private member function of HazardPointers
+// Takes a record that an exited thread gave back, or adds a new one to the list
+inline HazardPointers::Record* HazardPointers::acquireRecord()
+{
+	Registry& theRegistry = registry();
+	for(Record* recordPtr = theRegistry.headPtr.load(std::memory_order_acquire); recordPtr != nullptr; recordPtr = recordPtr->next)
+	{
+		bool wasInUse = false;
+		if(!recordPtr->inUse.load(std::memory_order_relaxed)
+		   && recordPtr->inUse.compare_exchange_strong(wasInUse, true, std::memory_order_acquire))
+			return recordPtr;
+	}
+
+	Record* recordPtr = new Record;
+	for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+		recordPtr->hazards[slot].store(nullptr, std::memory_order_relaxed);
+	recordPtr->inUse.store(true, std::memory_order_relaxed);
+	recordPtr->retired = nullptr;
+	recordPtr->retiredCount = 0;
+	recordPtr->maxRetired = 0;
+	// counted before it is linked in; a scan sizes its buffer by the count, but grows it if needed
+	theRegistry.recordCount.fetch_add(1, std::memory_order_release);
+	recordPtr->next = theRegistry.headPtr.load(std::memory_order_relaxed);
+	while(!theRegistry.headPtr.compare_exchange_weak(recordPtr->next, recordPtr, std::memory_order_release))
+		;
+	return recordPtr;
+}
+
+// private member function of HazardPointers
+// Deletes the retired nodes of recordPtr that no hazard slot holds; keeps the others for later
+inline void HazardPointers::scan(Record* recordPtr)
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	Registry& theRegistry = registry();
+	int maxHazards = SLOTS_PER_THREAD * theRegistry.recordCount.load(std::memory_order_acquire);
+	void** hazards = allocateItems<void*>(maxHazards);
+	int hazardCount = 0;
+	// records are linked in at the head, so ones added since recordCount was read come first:
+	// walk the whole list, growing the buffer, or an older record's hazards could be missed
+	for(Record* otherPtr = theRegistry.headPtr.load(std::memory_order_acquire);
+		otherPtr != nullptr; otherPtr = otherPtr->next)
+	{
+		if(hazardCount + SLOTS_PER_THREAD > maxHazards)
+		{
+			int newCapacity = grownCapacity(maxHazards, hazardCount + SLOTS_PER_THREAD);
+			hazards = reallocateItems(hazards, hazardCount, newCapacity);
+			maxHazards = newCapacity;
+		}
+		for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+		{
+			void* hazard = otherPtr->hazards[slot].load();
+			if(hazard != nullptr)
+				hazards[hazardCount++] = hazard;
+		}
+	}
+	std::sort(hazards, hazards + hazardCount, std::less<void*>());
+
+	int keptCount = 0;
+	for(int i = 0; i < recordPtr->retiredCount; i++)
+	{
+		RetiredNode& retiredNode = recordPtr->retired[i];
+		if(std::binary_search(hazards, hazards + hazardCount, retiredNode.nodePtr, std::less<void*>()))
+			recordPtr->retired[keptCount++] = retiredNode;
+		else
+			retiredNode.deleteNode(retiredNode.nodePtr);
+	}
+	recordPtr->retiredCount = keptCount;
+	freeItems(hazards);
+}
+
+// private member function of HazardPointers
+template<class NodeType>
+void HazardPointers::deleteNode(void* nodePtr)
+{
+	delete static_cast<NodeType*>(nodePtr);
+}
+
+inline HazardPointers::ThreadRecord::ThreadRecord() : recordPtr(acquireRecord())
+{
+}
+
+inline HazardPointers::ThreadRecord::~ThreadRecord()
+{
+	for(int slot = 0; slot < SLOTS_PER_THREAD; slot++)
+		recordPtr->hazards[slot].store(nullptr, std::memory_order_release);
+	scan(recordPtr); // what is still protected goes with the record to its next thread
+	recordPtr->inUse.store(false, std::memory_order_release);
+}
+
+inline HazardPointers::Registry::Registry() : headPtr(nullptr), recordCount(0)
+{
+}
+
+inline HazardPointers::Registry::~Registry()
+{
+	// the program is ending: no thread reads a node any more
+	Record* recordPtr = headPtr.load(std::memory_order_acquire);
+	while(recordPtr != nullptr)
+	{
+		for(int i = 0; i < recordPtr->retiredCount; i++)
+			recordPtr->retired[i].deleteNode(recordPtr->retired[i].nodePtr);
+		freeItems(recordPtr->retired);
+		Record* recordToDeletePtr = recordPtr;
+		recordPtr = recordPtr->next;
+		delete recordToDeletePtr;
+	}
+}
+#endif // !_HAZARD_POINTER_H_
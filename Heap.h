@@ -1,172 +1,1580 @@
-// Heap.h
-#ifndef _HEAP_H_
-#define _HEAP_H_
-#include <cmath>
-#include <stdexcept>
-using namespace std;
-
-template<class ItemType>
-class HeapInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual int getNumberOfNodes() const = 0;
-	virtual int getHeight() const = 0;
-	virtual ItemType peekTop() const = 0;
-	virtual bool add(const ItemType& newData) = 0;
-	virtual bool remove() = 0;
-	virtual void clear() = 0;
-};
-
-template<class ItemType>
-class ArrayMaxHeap : public HeapInterface<ItemType>
-{
-private:
-	static const int DEFAULT_CAPACITY = 21;
-	ItemType* items;
-	int itemCount;
-	int maxItems;
-	void heapRebuild(int rootIndex);
-public:
-	ArrayMaxHeap();
-	ArrayMaxHeap(const ArrayMaxHeap<ItemType>& aHeap);
-	~ArrayMaxHeap();
-	bool isEmpty() const;
-	int getNumberOfNodes() const;
-	int getHeight() const;
-	ItemType peekTop() const;
-	bool add(const ItemType& newData);
-	bool remove();
-	void clear();
-};
-
-//=================================================================================================
-// ArrayMaxHeap
-//=================================================================================================
-template<class ItemType>
-ArrayMaxHeap<ItemType>::ArrayMaxHeap() : itemCount(0), maxItems(DEFAULT_CAPACITY)
-{
-	items = new ItemType[maxItems];
-}
-
-template<class ItemType>
-ArrayMaxHeap<ItemType>::ArrayMaxHeap(const ArrayMaxHeap<ItemType>& aHeap)
-{
-	itemCount = aHeap.itemCount;
-	maxItems = aHeap.maxItems;
-	items = new ItemType[maxItems];
-	for(int i = 0; i < itemCount; i++) {
-		items[i] = aHeap.items[i];
-	}
-}
-
-template<class ItemType>
-ArrayMaxHeap<ItemType>::~ArrayMaxHeap()
-{
-	delete[] items;
-}
-
-template<class ItemType>
-bool ArrayMaxHeap<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<class ItemType>
-int ArrayMaxHeap<ItemType>::getNumberOfNodes() const
-{
-	return itemCount;
-}
-
-template<class ItemType>
-int ArrayMaxHeap<ItemType>::getHeight() const
-{
-	return ceil(log2(itemCount + 1));
-}
-
-template<class ItemType>
-ItemType ArrayMaxHeap<ItemType>::peekTop() const
-{
-	if(isEmpty())
-		throw logic_error("Precondition Violated Exception: peekTop() called with an empty heap.\n");
-
-	return items[0];
-}
-
-template<class ItemType>
-bool ArrayMaxHeap<ItemType>::add(const ItemType& newData)
-{
-	bool hasRoomToAdd = (itemCount < maxItems);
-	if(!hasRoomToAdd)
-	{
-		ItemType* oldArray = items;
-		items = new ItemType[2 * maxItems];
-		for(int i = 0; i < maxItems; i++)
-			items[i] = oldArray[i];
-		delete[] oldArray;
-		maxItems *= 2;
-	}
-
-	items[itemCount] = newData;
-
-	int newDataIndex = itemCount;
-	bool inPlace = false;
-	while((newDataIndex > 0) && !inPlace)
-	{
-		int parentIndex = (newDataIndex - 1) / 2;
-		if(items[newDataIndex] > items[parentIndex])
-		{
-			ItemType temp = items[newDataIndex];
-			items[newDataIndex] = items[parentIndex];
-			items[parentIndex] = temp;
-
-			newDataIndex = parentIndex;
-		}
-		else
-			inPlace = true;
-	}
-	itemCount++;
-
-	return true;
-}
-
-template<class ItemType>
-bool ArrayMaxHeap<ItemType>::remove()
-{
-	items[0] = items[itemCount - 1];
-	itemCount--;
-	heapRebuild(0);
-	return true;
-}
-
-template<class ItemType>
-void ArrayMaxHeap<ItemType>::clear()
-{
-	itemCount = 0;
-}
-
-// private member function of ArrayMaxHeap
-template<class ItemType>
-void ArrayMaxHeap<ItemType>::heapRebuild(int rootIndex)
-{
-	if(2 * rootIndex + 1 < itemCount) // the root is not a leaf (that is, it has a left child)
-	{
-		int largerChildIndex = 2 * rootIndex + 1; // left child index
-		if(largerChildIndex + 1 < itemCount) // the root has a right child
-		{
-			int rightChildIndex = largerChildIndex + 1;
-			if(items[rightChildIndex] > items[largerChildIndex])
-				largerChildIndex = rightChildIndex;
-		}
-
-		if(items[rootIndex] < items[largerChildIndex])
-		{	// swap
-			ItemType temp = items[rootIndex];
-			items[rootIndex] = items[largerChildIndex];
-			items[largerChildIndex] = temp;
-
-			heapRebuild(largerChildIndex);
-		}
-	}
-}
-#endif // !_HEAP_H_
+// Heap.h
+#ifndef _HEAP_H_
+#define _HEAP_H_
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "ArrayStorage.h"
+using namespace std;
+
+template<class ItemType>
+class HeapInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual int getNumberOfNodes() const = 0;
+	virtual int getHeight() const = 0;
+	virtual ItemType peekTop() const = 0;
+	virtual bool add(const ItemType& newData) = 0;
+	virtual bool remove() = 0;
+	virtual void clear() = 0;
+};
+
+// Compare orders the items the way operator< does (the default), and the top is a biggest item.
+// A min heap is ArrayMaxHeap<ItemType, greater<ItemType> >; see KeyCompare.h to order by a key.
+template<class ItemType, class Compare = less<ItemType> >
+class ArrayMaxHeap : public HeapInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 21;
+	ItemType* items; // uninitialized past itemCount
+	int itemCount;
+	int maxItems;
+	Compare compare;
+	void heapRebuild(int rootIndex);
+	void heapCreate();              // turns items[0 .. itemCount - 1] into a heap, O(N)
+	void siftUp(int newDataIndex);
+	void heapifyAppended(int oldCount); // items[oldCount ..] were appended: puts them in order
+	template<class InputIterator>
+	void append(InputIterator first, InputIterator last); // leaves the new items unordered
+public:
+	ArrayMaxHeap();
+	ArrayMaxHeap(const ItemType someArray[], const int arraySize); // O(N): copies, then heapCreate()
+	template<class InputIterator>
+	ArrayMaxHeap(InputIterator first, InputIterator last);         // O(N): copies, then heapCreate()
+	ArrayMaxHeap(const ArrayMaxHeap<ItemType, Compare>& aHeap);
+	ArrayMaxHeap(ArrayMaxHeap<ItemType, Compare>&& aHeap);
+	~ArrayMaxHeap();
+	bool isEmpty() const;
+	int getNumberOfNodes() const;
+	int getHeight() const;
+	ItemType peekTop() const;
+	bool add(const ItemType& newData);
+	bool add(ItemType&& newData);
+	template<class... Args>
+	bool emplace(Args&&... args); // builds the new entry in place
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last); // replaces the contents, O(N)
+	void merge(ArrayMaxHeap<ItemType, Compare>&& aHeap); // moves every item of aHeap here, O(N + M); aHeap is left empty
+	bool remove();
+	void clear();
+	void reserve(int newCapacity); // makes room for newCapacity items (never shrinks)
+	void shrink_to_fit();          // gives back the capacity past getNumberOfNodes()
+	const ArrayMaxHeap<ItemType, Compare>& operator=(ArrayMaxHeap<ItemType, Compare>&& aHeap);
+};
+
+// Max heap where every node has D children: the tree is log_D(N) levels deep instead of
+// log_2(N), and sift-down compares all D children of a node, which sit next to each other.
+// The storage is cache-line aligned and the root is placed so that every group of
+// siblings starts at a multiple of D; with D * sizeof(ItemType) <= 64 a sift-down
+// touches one cache line per level.
+template<class ItemType, int D = 4, class Compare = less<ItemType> >
+class DaryHeap : public HeapInterface<ItemType>
+{
+	static_assert(D >= 2, "a heap node needs at least 2 children");
+private:
+	static const int DEFAULT_CAPACITY = 21;
+	static const int CACHE_LINE = 64;
+	ItemType* storage; // aligned block; the first D - 1 slots are never used
+	ItemType* items;   // storage + D - 1, so the children of i, items[D*i+1 .. D*i+D], are aligned
+	int itemCount;
+	int maxItems;
+	Compare compare;
+	void heapRebuild(int rootIndex);
+	void heapCreate();
+	void siftUp(int newDataIndex);
+	void resize(int newCapacity);
+	void heapifyAppended(int oldCount);
+	template<class InputIterator>
+	void append(InputIterator first, InputIterator last);
+public:
+	DaryHeap();
+	DaryHeap(const ItemType someArray[], const int arraySize);
+	template<class InputIterator>
+	DaryHeap(InputIterator first, InputIterator last);
+	DaryHeap(const DaryHeap<ItemType, D, Compare>& aHeap);
+	DaryHeap(DaryHeap<ItemType, D, Compare>&& aHeap);
+	~DaryHeap();
+	bool isEmpty() const;
+	int getNumberOfNodes() const;
+	int getHeight() const;
+	ItemType peekTop() const;
+	bool add(const ItemType& newData);
+	bool add(ItemType&& newData);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last);
+	void merge(DaryHeap<ItemType, D, Compare>&& aHeap);
+	bool remove();
+	void clear();
+	void reserve(int newCapacity);
+	void shrink_to_fit();
+	const DaryHeap<ItemType, D, Compare>& operator=(DaryHeap<ItemType, D, Compare>&& aHeap);
+};
+
+// ArrayMaxHeap that can reach its items after adding them: insert() returns a Handle,
+// and updatePriority() / erase() take one, in O(log N).
+// A position map (handle -> index in items) is kept up to date every time the
+// sift loops move an item.
+template<class ItemType, class Compare = less<ItemType> >
+class IndexedMaxHeap : public HeapInterface<ItemType>
+{
+public:
+	typedef int Handle; // names one item until it leaves the heap; may be given out again after that
+private:
+	static const int DEFAULT_CAPACITY = 21;
+	ItemType* items;     // uninitialized past itemCount
+	Handle* itemHandles; // itemHandles[i] is the handle of items[i]
+	int* positions;      // positions[handle] is its index in items; < 0 for a free handle (see releaseHandle)
+	int itemCount;
+	int handleCount;     // handles 0 .. handleCount - 1 have been given out (handleCount <= maxItems)
+	Handle freeHandle;   // first free handle below handleCount, or -1
+	int maxItems;
+	Compare compare;
+	void heapRebuild(int rootIndex);
+	void siftUp(int newDataIndex);
+	void reposition(int index); // items[index] changed: moves it up or down to its place
+	void removeAt(int index);
+	Handle takeHandle();
+	void releaseHandle(Handle handle);
+	void resize(int newCapacity);
+public:
+	IndexedMaxHeap();
+	IndexedMaxHeap(const IndexedMaxHeap<ItemType, Compare>& aHeap); // the copy keeps the handles
+	IndexedMaxHeap(IndexedMaxHeap<ItemType, Compare>&& aHeap);
+	~IndexedMaxHeap();
+	bool isEmpty() const;
+	int getNumberOfNodes() const;
+	int getHeight() const;
+	ItemType peekTop() const;
+	Handle peekTopHandle() const;
+	bool add(const ItemType& newData);
+	Handle insert(const ItemType& newData);
+	Handle insert(ItemType&& newData);
+	template<class... Args>
+	Handle emplace(Args&&... args);
+	bool contains(Handle handle) const;
+	ItemType getEntry(Handle handle) const;
+	bool updatePriority(Handle handle, const ItemType& newData); // false if handle is not in the heap
+	bool updatePriority(Handle handle, ItemType&& newData);
+	bool erase(Handle handle);
+	bool remove();
+	void clear(); // every handle is given up
+	void reserve(int newCapacity);
+	const IndexedMaxHeap<ItemType, Compare>& operator=(IndexedMaxHeap<ItemType, Compare>&& aHeap);
+};
+
+// Keeps the K biggest items (by Compare) of everything offered to it, in room for exactly K items
+// that is taken once by the constructor. The kept items form a min heap, so an item that does not
+// make the cut is turned down by a single comparison with the root; one that does replaces it.
+// Not a HeapInterface: offer() is not virtual and can be inlined into the caller's loop.
+// ex: TopK<Hit, 1000, KeyCompare<Hit, MemberKey<Hit, double, &Hit::score> > > best;
+template<class ItemType, int K, class Compare = less<ItemType> >
+class TopK
+{
+private:
+	ItemType* items; // items[0] is the smallest kept item; uninitialized past itemCount
+	int itemCount;
+	Compare compare;
+	void heapRebuild(int rootIndex); // heapSiftDown with the order reversed: the smallest is on top
+	void siftUp(int newDataIndex);
+	template<class... Args>
+	bool push(Args&&... args); // only while not full
+public:
+	TopK();
+	TopK(const TopK<ItemType, K, Compare>& aTopK);
+	TopK(TopK<ItemType, K, Compare>&& aTopK);
+	~TopK();
+	bool isEmpty() const;
+	bool isFull() const; // K items are kept: from now on a new item must beat peekThreshold()
+	int getNumberOfItems() const;
+	int getCapacity() const;
+	ItemType peekThreshold() const; // the smallest kept item
+	bool offer(const ItemType& newData); // true if newData is kept
+	bool offer(ItemType&& newData);
+	template<class InputIterator>
+	int offer(InputIterator first, InputIterator last); // returns how many were kept (some may be pushed out again)
+	template<class OutputIterator>
+	OutputIterator takeSorted(OutputIterator result); // moves the kept items out, biggest first, and clears
+	void clear();
+	const TopK<ItemType, K, Compare>& operator=(TopK<ItemType, K, Compare>&& aTopK);
+};
+
+// The order of Compare turned around (for the min heap of TopK and the back half in nthElement)
+template<class Compare>
+struct ReversedCompare
+{
+	Compare& compare;
+	ReversedCompare(Compare& aCompare) : compare(aCompare)
+	{
+	}
+	template<class LeftType, class RightType>
+	bool operator()(const LeftType& leftItem, const RightType& rightItem)
+	{
+		return compare(rightItem, leftItem);
+	}
+};
+
+// Heap algorithms for a caller's own items: a raw array (ex: heapSort(items, items + count))
+// or any random-access range, rearranged in place with no allocation.
+// They run on heapSiftDown, the sift-down of ArrayMaxHeap; without a Compare, operator< is used.
+
+// first[0 .. count - 1] is a heap except maybe at rootIndex: moves first[rootIndex] down to its place
+template<class RandomAccessIterator, class Distance, class Compare>
+void heapSiftDown(RandomAccessIterator first, Distance rootIndex, Distance count, Compare& compare);
+template<class RandomAccessIterator, class Distance, class Compare>
+void heapMake(RandomAccessIterator first, Distance count, Compare& compare); // O(N)
+
+// Sorts [first, last) into ascending order, O(N log N)
+template<class RandomAccessIterator, class Compare>
+void heapSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare);
+template<class RandomAccessIterator>
+void heapSort(RandomAccessIterator first, RandomAccessIterator last);
+
+// Puts the smallest middle - first items of [first, last) in [first, middle), sorted;
+// the others are left in [middle, last) in no order. O(N log M), M = middle - first
+template<class RandomAccessIterator, class Compare>
+void partialSort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare compare);
+template<class RandomAccessIterator>
+void partialSort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last);
+
+// Puts at nth the item a sort would put there, with no bigger item before it and no smaller
+// one after it. O(N log M), M = the shorter of [first, nth] and [nth, last)
+template<class RandomAccessIterator, class Compare>
+void nthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare);
+template<class RandomAccessIterator>
+void nthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last);
+
+//=================================================================================================
+// ArrayMaxHeap
+//=================================================================================================
+template<class ItemType, class Compare>
+ArrayMaxHeap<ItemType, Compare>::ArrayMaxHeap() : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+}
+
+template<class ItemType, class Compare>
+ArrayMaxHeap<ItemType, Compare>::ArrayMaxHeap(const ItemType someArray[], const int arraySize)
+	: items(nullptr), itemCount(0), maxItems(0)
+{
+	assign(someArray, someArray + arraySize);
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+ArrayMaxHeap<ItemType, Compare>::ArrayMaxHeap(InputIterator first, InputIterator last)
+	: items(nullptr), itemCount(0), maxItems(0)
+{
+	assign(first, last);
+}
+
+template<class ItemType, class Compare>
+ArrayMaxHeap<ItemType, Compare>::ArrayMaxHeap(const ArrayMaxHeap<ItemType, Compare>& aHeap)
+{
+	itemCount = aHeap.itemCount;
+	maxItems = aHeap.maxItems;
+	items = allocateItems<ItemType>(maxItems);
+	copyItems(items, aHeap.items, itemCount);
+}
+
+template<class ItemType, class Compare>
+ArrayMaxHeap<ItemType, Compare>::ArrayMaxHeap(ArrayMaxHeap<ItemType, Compare>&& aHeap)
+	: items(aHeap.items), itemCount(aHeap.itemCount), maxItems(aHeap.maxItems)
+{
+	// aHeap is left empty with no capacity; its next add() allocates again
+	aHeap.items = nullptr;
+	aHeap.itemCount = 0;
+	aHeap.maxItems = 0;
+}
+
+template<class ItemType, class Compare>
+ArrayMaxHeap<ItemType, Compare>::~ArrayMaxHeap()
+{
+	destroyItems(items, 0, itemCount);
+	freeItems(items);
+}
+
+template<class ItemType, class Compare>
+bool ArrayMaxHeap<ItemType, Compare>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, class Compare>
+int ArrayMaxHeap<ItemType, Compare>::getNumberOfNodes() const
+{
+	return itemCount;
+}
+
+template<class ItemType, class Compare>
+int ArrayMaxHeap<ItemType, Compare>::getHeight() const
+{
+	return ceil(log2(itemCount + 1));
+}
+
+template<class ItemType, class Compare>
+ItemType ArrayMaxHeap<ItemType, Compare>::peekTop() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peekTop() called with an empty heap.\n");
+
+	return items[0];
+}
+
+template<class ItemType, class Compare>
+bool ArrayMaxHeap<ItemType, Compare>::add(const ItemType& newData)
+{
+	return emplace(newData);
+}
+
+template<class ItemType, class Compare>
+bool ArrayMaxHeap<ItemType, Compare>::add(ItemType&& newData)
+{
+	return emplace(move(newData));
+}
+
+template<class ItemType, class Compare>
+template<class... Args>
+bool ArrayMaxHeap<ItemType, Compare>::emplace(Args&&... args)
+{
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if(hasRoomToAdd)
+	{
+		new (&items[itemCount]) ItemType(forward<Args>(args)...);
+	}
+	else
+	{
+		ItemType newData(forward<Args>(args)...); // before growing: args may refer into items
+		reserve((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+		new (&items[itemCount]) ItemType(move(newData));
+	}
+	siftUp(itemCount);
+	itemCount++;
+
+	return true;
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+bool ArrayMaxHeap<ItemType, Compare>::addAll(InputIterator first, InputIterator last)
+{
+	int oldCount = itemCount;
+	append(first, last);
+	heapifyAppended(oldCount);
+
+	return true;
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+void ArrayMaxHeap<ItemType, Compare>::assign(InputIterator first, InputIterator last)
+{
+	clear();
+	int count = rangeLength(first, last);
+	if(count > maxItems) // nothing to keep: trade the storage for exactly enough
+	{
+		freeItems(items);
+		items = nullptr;
+		maxItems = 0;
+		items = allocateItems<ItemType>(count);
+		maxItems = count;
+	}
+	else if(count < 0 && maxItems == 0)
+		reserve(DEFAULT_CAPACITY);
+	append(first, last);
+	heapCreate();
+}
+
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::merge(ArrayMaxHeap<ItemType, Compare>&& aHeap)
+{
+	if(this == &aHeap)
+		return;
+
+	// the bigger heap stays where it is and the smaller one is moved over
+	if(aHeap.itemCount > itemCount)
+	{
+		swap(items, aHeap.items);
+		swap(itemCount, aHeap.itemCount);
+		swap(maxItems, aHeap.maxItems);
+	}
+	int oldCount = itemCount;
+	if(itemCount + aHeap.itemCount > maxItems)
+		reserve(grownCapacity(maxItems, itemCount + aHeap.itemCount));
+	relocateItems(items + itemCount, aHeap.items, aHeap.itemCount);
+	itemCount += aHeap.itemCount;
+	aHeap.itemCount = 0;
+	heapifyAppended(oldCount);
+}
+
+template<class ItemType, class Compare>
+bool ArrayMaxHeap<ItemType, Compare>::remove()
+{
+	if(isEmpty())
+		return false;
+
+	itemCount--;
+	if(itemCount == 0)
+	{
+		destroyItems(items, 0, 1);
+		return true;
+	}
+
+	// Floyd's bottom-up deletion: the last item almost always belongs near the bottom,
+	// so walk the hole left by the top down to a leaf along the larger children
+	// (one comparison per level instead of two), then let the last item climb from there.
+	ItemType lastData(move(items[itemCount]));
+	destroyItems(items, itemCount, itemCount + 1);
+	int holeIndex = 0;
+	int childIndex = 1;
+	while(childIndex < itemCount)
+	{
+		if(childIndex + 1 < itemCount && compare(items[childIndex], items[childIndex + 1]))
+			childIndex++;
+		items[holeIndex] = move(items[childIndex]);
+		holeIndex = childIndex;
+		childIndex = 2 * holeIndex + 1;
+	}
+	items[holeIndex] = move(lastData);
+	siftUp(holeIndex);
+	return true;
+}
+
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+}
+
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::reserve(int newCapacity)
+{
+	if(newCapacity > maxItems)
+	{
+		items = reallocateItems(items, itemCount, newCapacity);
+		maxItems = newCapacity;
+	}
+}
+
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::shrink_to_fit()
+{
+	if(itemCount < maxItems)
+	{
+		items = reallocateItems(items, itemCount, itemCount);
+		maxItems = itemCount;
+	}
+}
+
+template<class ItemType, class Compare>
+const ArrayMaxHeap<ItemType, Compare>& ArrayMaxHeap<ItemType, Compare>::operator=(ArrayMaxHeap<ItemType, Compare>&& aHeap)
+{
+	if(this != &aHeap)
+	{
+		destroyItems(items, 0, itemCount);
+		freeItems(items);
+		items = aHeap.items;
+		itemCount = aHeap.itemCount;
+		maxItems = aHeap.maxItems;
+		aHeap.items = nullptr;
+		aHeap.itemCount = 0;
+		aHeap.maxItems = 0;
+	}
+	return *this;
+}
+
+// private member function of ArrayMaxHeap
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::heapRebuild(int rootIndex)
+{
+	heapSiftDown(items, rootIndex, itemCount, compare);
+}
+
+// private member function of ArrayMaxHeap
+template<class ItemType, class Compare>
+template<class InputIterator>
+void ArrayMaxHeap<ItemType, Compare>::append(InputIterator first, InputIterator last)
+{
+	int count = rangeLength(first, last);
+	if(count > 0 && itemCount + count > maxItems)
+		reserve(grownCapacity(maxItems, itemCount + count));
+	for(; first != last; ++first)
+	{
+		if(itemCount == maxItems) // only for single-pass ranges
+			reserve(grownCapacity(maxItems, itemCount + 1));
+		new (&items[itemCount]) ItemType(*first);
+		itemCount++;
+	}
+}
+
+// private member function of ArrayMaxHeap
+// A few new items: sift each one up, O(k log N); many: rebuild the whole heap, O(N)
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::heapifyAppended(int oldCount)
+{
+	if(itemCount - oldCount <= oldCount / 2)
+	{
+		for(int i = oldCount; i < itemCount; i++)
+			siftUp(i);
+	}
+	else
+		heapCreate();
+}
+
+// private member function of ArrayMaxHeap
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::heapCreate()
+{
+	for(int index = itemCount / 2 - 1; index >= 0; index--) // from the last non-leaf up to the root
+		heapRebuild(index);
+}
+
+// private member function of ArrayMaxHeap
+// items[0 .. newDataIndex - 1] is a heap; moves items[newDataIndex] up to its place
+template<class ItemType, class Compare>
+void ArrayMaxHeap<ItemType, Compare>::siftUp(int newDataIndex)
+{
+	int parentIndex = (newDataIndex - 1) / 2;
+	if((newDataIndex == 0) || !compare(items[parentIndex], items[newDataIndex])) // already in place
+		return;
+
+	// same hole technique as heapRebuild, upwards
+	ItemType newData(move(items[newDataIndex]));
+	int holeIndex = newDataIndex;
+	do
+	{
+		items[holeIndex] = move(items[parentIndex]);
+		holeIndex = parentIndex;
+		parentIndex = (holeIndex - 1) / 2;
+	} while((holeIndex > 0) && (compare(items[parentIndex], newData)));
+	items[holeIndex] = move(newData);
+}
+
+//=================================================================================================
+// DaryHeap
+//=================================================================================================
+template<class ItemType, int D, class Compare>
+DaryHeap<ItemType, D, Compare>::DaryHeap() : storage(nullptr), items(nullptr), itemCount(0), maxItems(0)
+{
+	resize(DEFAULT_CAPACITY);
+}
+
+template<class ItemType, int D, class Compare>
+DaryHeap<ItemType, D, Compare>::DaryHeap(const ItemType someArray[], const int arraySize)
+	: storage(nullptr), items(nullptr), itemCount(0), maxItems(0)
+{
+	assign(someArray, someArray + arraySize);
+}
+
+template<class ItemType, int D, class Compare>
+template<class InputIterator>
+DaryHeap<ItemType, D, Compare>::DaryHeap(InputIterator first, InputIterator last)
+	: storage(nullptr), items(nullptr), itemCount(0), maxItems(0)
+{
+	assign(first, last);
+}
+
+template<class ItemType, int D, class Compare>
+DaryHeap<ItemType, D, Compare>::DaryHeap(const DaryHeap<ItemType, D, Compare>& aHeap)
+	: storage(nullptr), items(nullptr), itemCount(0), maxItems(0)
+{
+	resize(aHeap.maxItems);
+	copyItems(items, aHeap.items, aHeap.itemCount);
+	itemCount = aHeap.itemCount;
+}
+
+template<class ItemType, int D, class Compare>
+DaryHeap<ItemType, D, Compare>::DaryHeap(DaryHeap<ItemType, D, Compare>&& aHeap)
+	: storage(aHeap.storage), items(aHeap.items), itemCount(aHeap.itemCount), maxItems(aHeap.maxItems)
+{
+	// aHeap is left empty with no capacity; its next add() allocates again
+	aHeap.storage = nullptr;
+	aHeap.items = nullptr;
+	aHeap.itemCount = 0;
+	aHeap.maxItems = 0;
+}
+
+template<class ItemType, int D, class Compare>
+DaryHeap<ItemType, D, Compare>::~DaryHeap()
+{
+	destroyItems(items, 0, itemCount);
+	freeAlignedItems(storage);
+}
+
+template<class ItemType, int D, class Compare>
+bool DaryHeap<ItemType, D, Compare>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, int D, class Compare>
+int DaryHeap<ItemType, D, Compare>::getNumberOfNodes() const
+{
+	return itemCount;
+}
+
+template<class ItemType, int D, class Compare>
+int DaryHeap<ItemType, D, Compare>::getHeight() const
+{
+	int height = 0;
+	long long levelSize = 1;
+	for(long long nodesAbove = 0; nodesAbove < itemCount; nodesAbove += levelSize, levelSize *= D)
+		height++;
+	return height;
+}
+
+template<class ItemType, int D, class Compare>
+ItemType DaryHeap<ItemType, D, Compare>::peekTop() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peekTop() called with an empty heap.\n");
+
+	return items[0];
+}
+
+template<class ItemType, int D, class Compare>
+bool DaryHeap<ItemType, D, Compare>::add(const ItemType& newData)
+{
+	return emplace(newData);
+}
+
+template<class ItemType, int D, class Compare>
+bool DaryHeap<ItemType, D, Compare>::add(ItemType&& newData)
+{
+	return emplace(move(newData));
+}
+
+template<class ItemType, int D, class Compare>
+template<class... Args>
+bool DaryHeap<ItemType, D, Compare>::emplace(Args&&... args)
+{
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if(hasRoomToAdd)
+	{
+		new (&items[itemCount]) ItemType(forward<Args>(args)...);
+	}
+	else
+	{
+		ItemType newData(forward<Args>(args)...); // before growing: args may refer into items
+		resize((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+		new (&items[itemCount]) ItemType(move(newData));
+	}
+	siftUp(itemCount);
+	itemCount++;
+
+	return true;
+}
+
+template<class ItemType, int D, class Compare>
+template<class InputIterator>
+bool DaryHeap<ItemType, D, Compare>::addAll(InputIterator first, InputIterator last)
+{
+	int oldCount = itemCount;
+	append(first, last);
+	heapifyAppended(oldCount);
+
+	return true;
+}
+
+template<class ItemType, int D, class Compare>
+template<class InputIterator>
+void DaryHeap<ItemType, D, Compare>::assign(InputIterator first, InputIterator last)
+{
+	clear();
+	int count = rangeLength(first, last);
+	if(count > maxItems)
+		resize(count);
+	else if(count < 0 && maxItems == 0)
+		resize(DEFAULT_CAPACITY);
+	append(first, last);
+	heapCreate();
+}
+
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::merge(DaryHeap<ItemType, D, Compare>&& aHeap)
+{
+	if(this == &aHeap)
+		return;
+
+	if(aHeap.itemCount > itemCount)
+	{
+		swap(storage, aHeap.storage);
+		swap(items, aHeap.items);
+		swap(itemCount, aHeap.itemCount);
+		swap(maxItems, aHeap.maxItems);
+	}
+	int oldCount = itemCount;
+	if(itemCount + aHeap.itemCount > maxItems)
+		resize(grownCapacity(maxItems, itemCount + aHeap.itemCount));
+	relocateItems(items + itemCount, aHeap.items, aHeap.itemCount);
+	itemCount += aHeap.itemCount;
+	aHeap.itemCount = 0;
+	heapifyAppended(oldCount);
+}
+
+template<class ItemType, int D, class Compare>
+bool DaryHeap<ItemType, D, Compare>::remove()
+{
+	if(isEmpty())
+		return false;
+
+	itemCount--;
+	if(itemCount == 0)
+	{
+		destroyItems(items, 0, 1);
+		return true;
+	}
+
+	// Floyd's bottom-up deletion, as in ArrayMaxHeap::remove()
+	ItemType lastData(move(items[itemCount]));
+	destroyItems(items, itemCount, itemCount + 1);
+	int holeIndex = 0;
+	int firstChildIndex = 1;
+	while(firstChildIndex < itemCount)
+	{
+		int endIndex = (firstChildIndex + D < itemCount) ? firstChildIndex + D : itemCount;
+		int largestChildIndex = firstChildIndex;
+		for(int i = firstChildIndex + 1; i < endIndex; i++)
+		{
+			if(compare(items[largestChildIndex], items[i]))
+				largestChildIndex = i;
+		}
+		items[holeIndex] = move(items[largestChildIndex]);
+		holeIndex = largestChildIndex;
+		firstChildIndex = D * holeIndex + 1;
+	}
+	items[holeIndex] = move(lastData);
+	siftUp(holeIndex);
+	return true;
+}
+
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+}
+
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::reserve(int newCapacity)
+{
+	if(newCapacity > maxItems)
+		resize(newCapacity);
+}
+
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::shrink_to_fit()
+{
+	if(itemCount < maxItems)
+		resize(itemCount);
+}
+
+template<class ItemType, int D, class Compare>
+const DaryHeap<ItemType, D, Compare>& DaryHeap<ItemType, D, Compare>::operator=(DaryHeap<ItemType, D, Compare>&& aHeap)
+{
+	if(this != &aHeap)
+	{
+		destroyItems(items, 0, itemCount);
+		freeAlignedItems(storage);
+		storage = aHeap.storage;
+		items = aHeap.items;
+		itemCount = aHeap.itemCount;
+		maxItems = aHeap.maxItems;
+		aHeap.storage = nullptr;
+		aHeap.items = nullptr;
+		aHeap.itemCount = 0;
+		aHeap.maxItems = 0;
+	}
+	return *this;
+}
+
+// private member function of DaryHeap
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::heapRebuild(int rootIndex)
+{
+	int firstChildIndex = D * rootIndex + 1;
+	if(firstChildIndex >= itemCount) // the root is a leaf
+		return;
+
+	ItemType rootData(move(items[rootIndex]));
+	int holeIndex = rootIndex;
+	while(firstChildIndex < itemCount)
+	{
+		int endIndex = (firstChildIndex + D < itemCount) ? firstChildIndex + D : itemCount;
+		int largestChildIndex = firstChildIndex;
+		for(int i = firstChildIndex + 1; i < endIndex; i++)
+		{
+			if(compare(items[largestChildIndex], items[i]))
+				largestChildIndex = i;
+		}
+
+		if(!compare(rootData, items[largestChildIndex]))
+			break;
+		items[holeIndex] = move(items[largestChildIndex]);
+		holeIndex = largestChildIndex;
+		firstChildIndex = D * holeIndex + 1;
+	}
+	items[holeIndex] = move(rootData);
+}
+
+// private member function of DaryHeap
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::heapifyAppended(int oldCount)
+{
+	if(itemCount - oldCount <= oldCount / 2)
+	{
+		for(int i = oldCount; i < itemCount; i++)
+			siftUp(i);
+	}
+	else
+		heapCreate();
+}
+
+// private member function of DaryHeap
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::heapCreate()
+{
+	for(int index = (itemCount - 2) / D; index >= 0; index--) // from the last non-leaf up to the root
+		heapRebuild(index);
+}
+
+// private member function of DaryHeap
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::siftUp(int newDataIndex)
+{
+	int parentIndex = (newDataIndex - 1) / D;
+	if((newDataIndex == 0) || !compare(items[parentIndex], items[newDataIndex])) // already in place
+		return;
+
+	ItemType newData(move(items[newDataIndex]));
+	int holeIndex = newDataIndex;
+	do
+	{
+		items[holeIndex] = move(items[parentIndex]);
+		holeIndex = parentIndex;
+		parentIndex = (holeIndex - 1) / D;
+	} while((holeIndex > 0) && (compare(items[parentIndex], newData)));
+	items[holeIndex] = move(newData);
+}
+
+// private member function of DaryHeap
+template<class ItemType, int D, class Compare>
+void DaryHeap<ItemType, D, Compare>::resize(int newCapacity)
+{
+	ItemType* newStorage = nullptr;
+	ItemType* newItems = nullptr;
+	if(newCapacity > 0)
+	{
+		newStorage = allocateAlignedItems<ItemType>(newCapacity + D - 1, CACHE_LINE);
+		newItems = newStorage + (D - 1);
+	}
+	relocateItems(newItems, items, itemCount);
+	freeAlignedItems(storage);
+	storage = newStorage;
+	items = newItems;
+	maxItems = newCapacity;
+}
+
+// private member function of DaryHeap
+template<class ItemType, int D, class Compare>
+template<class InputIterator>
+void DaryHeap<ItemType, D, Compare>::append(InputIterator first, InputIterator last)
+{
+	int count = rangeLength(first, last);
+	if(count > 0 && itemCount + count > maxItems)
+		resize(grownCapacity(maxItems, itemCount + count));
+	for(; first != last; ++first)
+	{
+		if(itemCount == maxItems) // only for single-pass ranges
+			resize(grownCapacity(maxItems, itemCount + 1));
+		new (&items[itemCount]) ItemType(*first);
+		itemCount++;
+	}
+}
+
+//=================================================================================================
+// IndexedMaxHeap
+//=================================================================================================
+template<class ItemType, class Compare>
+IndexedMaxHeap<ItemType, Compare>::IndexedMaxHeap()
+	: items(nullptr), itemHandles(nullptr), positions(nullptr), itemCount(0), handleCount(0), freeHandle(-1), maxItems(0)
+{
+	resize(DEFAULT_CAPACITY);
+}
+
+template<class ItemType, class Compare>
+IndexedMaxHeap<ItemType, Compare>::IndexedMaxHeap(const IndexedMaxHeap<ItemType, Compare>& aHeap)
+	: items(nullptr), itemHandles(nullptr), positions(nullptr), itemCount(0), handleCount(0), freeHandle(-1), maxItems(0)
+{
+	resize(aHeap.maxItems);
+	copyItems(items, aHeap.items, aHeap.itemCount);
+	copyItems(itemHandles, aHeap.itemHandles, aHeap.itemCount);
+	copyItems(positions, aHeap.positions, aHeap.handleCount);
+	itemCount = aHeap.itemCount;
+	handleCount = aHeap.handleCount;
+	freeHandle = aHeap.freeHandle;
+}
+
+template<class ItemType, class Compare>
+IndexedMaxHeap<ItemType, Compare>::IndexedMaxHeap(IndexedMaxHeap<ItemType, Compare>&& aHeap)
+	: items(aHeap.items), itemHandles(aHeap.itemHandles), positions(aHeap.positions), itemCount(aHeap.itemCount),
+	  handleCount(aHeap.handleCount), freeHandle(aHeap.freeHandle), maxItems(aHeap.maxItems)
+{
+	// aHeap is left empty with no capacity; its next insert() allocates again
+	aHeap.items = nullptr;
+	aHeap.itemHandles = nullptr;
+	aHeap.positions = nullptr;
+	aHeap.itemCount = 0;
+	aHeap.handleCount = 0;
+	aHeap.freeHandle = -1;
+	aHeap.maxItems = 0;
+}
+
+template<class ItemType, class Compare>
+IndexedMaxHeap<ItemType, Compare>::~IndexedMaxHeap()
+{
+	destroyItems(items, 0, itemCount);
+	freeItems(items);
+	freeItems(itemHandles);
+	freeItems(positions);
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, class Compare>
+int IndexedMaxHeap<ItemType, Compare>::getNumberOfNodes() const
+{
+	return itemCount;
+}
+
+template<class ItemType, class Compare>
+int IndexedMaxHeap<ItemType, Compare>::getHeight() const
+{
+	return ceil(log2(itemCount + 1));
+}
+
+template<class ItemType, class Compare>
+ItemType IndexedMaxHeap<ItemType, Compare>::peekTop() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peekTop() called with an empty heap.\n");
+
+	return items[0];
+}
+
+template<class ItemType, class Compare>
+typename IndexedMaxHeap<ItemType, Compare>::Handle IndexedMaxHeap<ItemType, Compare>::peekTopHandle() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peekTopHandle() called with an empty heap.\n");
+
+	return itemHandles[0];
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::add(const ItemType& newData)
+{
+	emplace(newData);
+	return true;
+}
+
+template<class ItemType, class Compare>
+typename IndexedMaxHeap<ItemType, Compare>::Handle IndexedMaxHeap<ItemType, Compare>::insert(const ItemType& newData)
+{
+	return emplace(newData);
+}
+
+template<class ItemType, class Compare>
+typename IndexedMaxHeap<ItemType, Compare>::Handle IndexedMaxHeap<ItemType, Compare>::insert(ItemType&& newData)
+{
+	return emplace(move(newData));
+}
+
+template<class ItemType, class Compare>
+template<class... Args>
+typename IndexedMaxHeap<ItemType, Compare>::Handle IndexedMaxHeap<ItemType, Compare>::emplace(Args&&... args)
+{
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if(hasRoomToAdd)
+	{
+		new (&items[itemCount]) ItemType(forward<Args>(args)...);
+	}
+	else
+	{
+		ItemType newData(forward<Args>(args)...); // before growing: args may refer into items
+		resize((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+		new (&items[itemCount]) ItemType(move(newData));
+	}
+	Handle handle = takeHandle();
+	itemHandles[itemCount] = handle;
+	positions[handle] = itemCount;
+	siftUp(itemCount);
+	itemCount++;
+
+	return handle;
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::contains(Handle handle) const
+{
+	return (0 <= handle) && (handle < handleCount) && (positions[handle] >= 0);
+}
+
+template<class ItemType, class Compare>
+ItemType IndexedMaxHeap<ItemType, Compare>::getEntry(Handle handle) const
+{
+	if(!contains(handle))
+		throw logic_error("Precondition Violated Exception: getEntry() called with a handle not in the heap.\n");
+
+	return items[positions[handle]];
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::updatePriority(Handle handle, const ItemType& newData)
+{
+	if(!contains(handle))
+		return false;
+
+	items[positions[handle]] = newData;
+	reposition(positions[handle]);
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::updatePriority(Handle handle, ItemType&& newData)
+{
+	if(!contains(handle))
+		return false;
+
+	items[positions[handle]] = move(newData);
+	reposition(positions[handle]);
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::erase(Handle handle)
+{
+	if(!contains(handle))
+		return false;
+
+	removeAt(positions[handle]);
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool IndexedMaxHeap<ItemType, Compare>::remove()
+{
+	if(isEmpty())
+		return false;
+
+	removeAt(0);
+	return true;
+}
+
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+	handleCount = 0;
+	freeHandle = -1;
+}
+
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::reserve(int newCapacity)
+{
+	if(newCapacity > maxItems)
+		resize(newCapacity);
+}
+
+template<class ItemType, class Compare>
+const IndexedMaxHeap<ItemType, Compare>& IndexedMaxHeap<ItemType, Compare>::operator=(IndexedMaxHeap<ItemType, Compare>&& aHeap)
+{
+	if(this != &aHeap)
+	{
+		destroyItems(items, 0, itemCount);
+		freeItems(items);
+		freeItems(itemHandles);
+		freeItems(positions);
+		items = aHeap.items;
+		itemHandles = aHeap.itemHandles;
+		positions = aHeap.positions;
+		itemCount = aHeap.itemCount;
+		handleCount = aHeap.handleCount;
+		freeHandle = aHeap.freeHandle;
+		maxItems = aHeap.maxItems;
+		aHeap.items = nullptr;
+		aHeap.itemHandles = nullptr;
+		aHeap.positions = nullptr;
+		aHeap.itemCount = 0;
+		aHeap.handleCount = 0;
+		aHeap.freeHandle = -1;
+		aHeap.maxItems = 0;
+	}
+	return *this;
+}
+
+// private member function of IndexedMaxHeap
+// heapSiftDown; each item moved into the hole has its position updated
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::heapRebuild(int rootIndex)
+{
+	if(2 * rootIndex + 1 >= itemCount) // the root is a leaf
+		return;
+
+	ItemType rootData(move(items[rootIndex]));
+	Handle rootHandle = itemHandles[rootIndex];
+	int holeIndex = rootIndex;
+	int largerChildIndex = 2 * holeIndex + 1; // left child index
+	while(largerChildIndex < itemCount)
+	{
+		if(largerChildIndex + 1 < itemCount // the hole has a right child
+		   && compare(items[largerChildIndex], items[largerChildIndex + 1]))
+			largerChildIndex++;
+
+		if(!compare(rootData, items[largerChildIndex]))
+			break;
+		items[holeIndex] = move(items[largerChildIndex]);
+		itemHandles[holeIndex] = itemHandles[largerChildIndex];
+		positions[itemHandles[holeIndex]] = holeIndex;
+		holeIndex = largerChildIndex;
+		largerChildIndex = 2 * holeIndex + 1;
+	}
+	items[holeIndex] = move(rootData);
+	itemHandles[holeIndex] = rootHandle;
+	positions[rootHandle] = holeIndex;
+}
+
+// private member function of IndexedMaxHeap
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::siftUp(int newDataIndex)
+{
+	int parentIndex = (newDataIndex - 1) / 2;
+	if((newDataIndex == 0) || !compare(items[parentIndex], items[newDataIndex])) // already in place
+		return;
+
+	ItemType newData(move(items[newDataIndex]));
+	Handle newHandle = itemHandles[newDataIndex];
+	int holeIndex = newDataIndex;
+	do
+	{
+		items[holeIndex] = move(items[parentIndex]);
+		itemHandles[holeIndex] = itemHandles[parentIndex];
+		positions[itemHandles[holeIndex]] = holeIndex;
+		holeIndex = parentIndex;
+		parentIndex = (holeIndex - 1) / 2;
+	} while((holeIndex > 0) && compare(items[parentIndex], newData));
+	items[holeIndex] = move(newData);
+	itemHandles[holeIndex] = newHandle;
+	positions[newHandle] = holeIndex;
+}
+
+// private member function of IndexedMaxHeap
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::reposition(int index)
+{
+	if((index > 0) && compare(items[(index - 1) / 2], items[index])) // bigger than its parent now
+		siftUp(index);
+	else
+		heapRebuild(index);
+}
+
+// private member function of IndexedMaxHeap
+// The last item fills the gap and is moved up or down from there
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::removeAt(int index)
+{
+	releaseHandle(itemHandles[index]);
+	itemCount--;
+	if(index < itemCount)
+	{
+		items[index] = move(items[itemCount]);
+		itemHandles[index] = itemHandles[itemCount];
+		positions[itemHandles[index]] = index;
+	}
+	destroyItems(items, itemCount, itemCount + 1);
+	if(index < itemCount)
+		reposition(index);
+}
+
+// private member function of IndexedMaxHeap
+// Reuses a released handle first; otherwise a new one (there is room: handleCount <= maxItems
+// and every handle below handleCount is either in use or free)
+template<class ItemType, class Compare>
+typename IndexedMaxHeap<ItemType, Compare>::Handle IndexedMaxHeap<ItemType, Compare>::takeHandle()
+{
+	if(freeHandle == -1)
+		return handleCount++;
+
+	Handle handle = freeHandle;
+	freeHandle = -2 - positions[handle];
+	return handle;
+}
+
+// private member function of IndexedMaxHeap
+// A free handle links to the next free one as positions[handle] = -2 - next (-1 at the end)
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::releaseHandle(Handle handle)
+{
+	positions[handle] = -2 - freeHandle;
+	freeHandle = handle;
+}
+
+// private member function of IndexedMaxHeap
+template<class ItemType, class Compare>
+void IndexedMaxHeap<ItemType, Compare>::resize(int newCapacity)
+{
+	items = reallocateItems(items, itemCount, newCapacity);
+	itemHandles = reallocateItems(itemHandles, itemCount, newCapacity);
+	positions = reallocateItems(positions, handleCount, newCapacity);
+	maxItems = newCapacity;
+}
+
+//=================================================================================================
+// TopK
+//=================================================================================================
+template<class ItemType, int K, class Compare>
+TopK<ItemType, K, Compare>::TopK() : itemCount(0)
+{
+	static_assert(K > 0, "TopK needs room for at least one item");
+	items = allocateItems<ItemType>(K);
+}
+
+template<class ItemType, int K, class Compare>
+TopK<ItemType, K, Compare>::TopK(const TopK<ItemType, K, Compare>& aTopK) : itemCount(aTopK.itemCount)
+{
+	items = allocateItems<ItemType>(K);
+	copyItems(items, aTopK.items, itemCount);
+}
+
+template<class ItemType, int K, class Compare>
+TopK<ItemType, K, Compare>::TopK(TopK<ItemType, K, Compare>&& aTopK)
+	: items(aTopK.items), itemCount(aTopK.itemCount)
+{
+	// aTopK gets fresh room, so it can still be offered items
+	aTopK.items = allocateItems<ItemType>(K);
+	aTopK.itemCount = 0;
+}
+
+template<class ItemType, int K, class Compare>
+TopK<ItemType, K, Compare>::~TopK()
+{
+	destroyItems(items, 0, itemCount);
+	freeItems(items);
+}
+
+template<class ItemType, int K, class Compare>
+bool TopK<ItemType, K, Compare>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, int K, class Compare>
+bool TopK<ItemType, K, Compare>::isFull() const
+{
+	return (itemCount == K);
+}
+
+template<class ItemType, int K, class Compare>
+int TopK<ItemType, K, Compare>::getNumberOfItems() const
+{
+	return itemCount;
+}
+
+template<class ItemType, int K, class Compare>
+int TopK<ItemType, K, Compare>::getCapacity() const
+{
+	return K;
+}
+
+template<class ItemType, int K, class Compare>
+ItemType TopK<ItemType, K, Compare>::peekThreshold() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peekThreshold() called with an empty TopK.\n");
+
+	return items[0];
+}
+
+template<class ItemType, int K, class Compare>
+bool TopK<ItemType, K, Compare>::offer(const ItemType& newData)
+{
+	if(itemCount < K)
+		return push(newData);
+	if(!compare(items[0], newData)) // no better than the worst kept item
+		return false;
+
+	items[0] = newData;
+	heapRebuild(0);
+	return true;
+}
+
+template<class ItemType, int K, class Compare>
+bool TopK<ItemType, K, Compare>::offer(ItemType&& newData)
+{
+	if(itemCount < K)
+		return push(move(newData));
+	if(!compare(items[0], newData))
+		return false;
+
+	items[0] = move(newData);
+	heapRebuild(0);
+	return true;
+}
+
+template<class ItemType, int K, class Compare>
+template<class InputIterator>
+int TopK<ItemType, K, Compare>::offer(InputIterator first, InputIterator last)
+{
+	int keptCount = 0;
+	for(; itemCount < K && first != last; ++first) // filling up
+	{
+		push(*first);
+		keptCount++;
+	}
+	for(; first != last; ++first)
+	{
+		if(compare(items[0], *first))
+		{
+			items[0] = *first;
+			heapRebuild(0);
+			keptCount++;
+		}
+	}
+	return keptCount;
+}
+
+template<class ItemType, int K, class Compare>
+template<class OutputIterator>
+OutputIterator TopK<ItemType, K, Compare>::takeSorted(OutputIterator result)
+{
+	// Heap sort in place: each pass swaps the smallest left to the back, which ends up
+	// with items[0 .. count - 1] from the biggest to the smallest
+	int count = itemCount;
+	while(itemCount > 1)
+	{
+		itemCount--;
+		swap(items[0], items[itemCount]);
+		heapRebuild(0);
+	}
+	for(int i = 0; i < count; i++)
+	{
+		*result = move(items[i]);
+		++result;
+	}
+	itemCount = count;
+	clear();
+	return result;
+}
+
+template<class ItemType, int K, class Compare>
+void TopK<ItemType, K, Compare>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+}
+
+template<class ItemType, int K, class Compare>
+const TopK<ItemType, K, Compare>& TopK<ItemType, K, Compare>::operator=(TopK<ItemType, K, Compare>&& aTopK)
+{
+	if(this != &aTopK)
+	{
+		clear();
+		swap(items, aTopK.items); // both keep room for K items
+		swap(itemCount, aTopK.itemCount);
+	}
+	return *this;
+}
+
+// private member function of TopK
+template<class ItemType, int K, class Compare>
+void TopK<ItemType, K, Compare>::heapRebuild(int rootIndex)
+{
+	ReversedCompare<Compare> greaterThan(compare);
+	heapSiftDown(items, rootIndex, itemCount, greaterThan);
+}
+
+// private member function of TopK
+template<class ItemType, int K, class Compare>
+void TopK<ItemType, K, Compare>::siftUp(int newDataIndex)
+{
+	int parentIndex = (newDataIndex - 1) / 2;
+	if((newDataIndex == 0) || !compare(items[newDataIndex], items[parentIndex]))
+		return;
+
+	ItemType newData(move(items[newDataIndex]));
+	int holeIndex = newDataIndex;
+	do
+	{
+		items[holeIndex] = move(items[parentIndex]);
+		holeIndex = parentIndex;
+		parentIndex = (holeIndex - 1) / 2;
+	} while((holeIndex > 0) && (compare(newData, items[parentIndex])));
+	items[holeIndex] = move(newData);
+}
+
+// private member function of TopK
+template<class ItemType, int K, class Compare>
+template<class... Args>
+bool TopK<ItemType, K, Compare>::push(Args&&... args)
+{
+	new (&items[itemCount]) ItemType(forward<Args>(args)...);
+	siftUp(itemCount);
+	itemCount++;
+	return true;
+}
+
+//=================================================================================================
+// Heap algorithms
+//=================================================================================================
+// Iterative: the root's item is taken out, leaving a hole that larger children move up into,
+// and is put back once where the hole stops.
+template<class RandomAccessIterator, class Distance, class Compare>
+void heapSiftDown(RandomAccessIterator first, Distance rootIndex, Distance count, Compare& compare)
+{
+	if(2 * rootIndex + 1 >= count) // the root is a leaf
+		return;
+
+	typename iterator_traits<RandomAccessIterator>::value_type rootData(move(first[rootIndex]));
+	Distance holeIndex = rootIndex;
+	Distance largerChildIndex = 2 * holeIndex + 1; // left child index
+	while(largerChildIndex < count)
+	{
+		if(largerChildIndex + 1 < count // the hole has a right child
+		   && compare(first[largerChildIndex], first[largerChildIndex + 1]))
+			largerChildIndex++;
+
+		if(!compare(rootData, first[largerChildIndex]))
+			break;
+		first[holeIndex] = move(first[largerChildIndex]);
+		holeIndex = largerChildIndex;
+		largerChildIndex = 2 * holeIndex + 1;
+	}
+	first[holeIndex] = move(rootData);
+}
+
+template<class RandomAccessIterator, class Distance, class Compare>
+void heapMake(RandomAccessIterator first, Distance count, Compare& compare)
+{
+	for(Distance index = count / 2 - 1; index >= 0; index--) // from the last non-leaf up to the root
+		heapSiftDown(first, index, count, compare);
+}
+
+// helper of heapSort and partialSort: first[0 .. count - 1] is a heap; sorts it
+template<class RandomAccessIterator, class Distance, class Compare>
+void heapSortHeap(RandomAccessIterator first, Distance count, Compare& compare)
+{
+	// Floyd's bottom-up deletion, as in ArrayMaxHeap::remove(): the hole left by the top
+	// goes down to a leaf along the larger children, then the item that was last climbs back
+	while(count > 1)
+	{
+		count--;
+		typename iterator_traits<RandomAccessIterator>::value_type lastData(move(first[count]));
+		first[count] = move(first[0]);
+		Distance holeIndex = 0;
+		Distance childIndex = 1;
+		while(childIndex < count)
+		{
+			if(childIndex + 1 < count && compare(first[childIndex], first[childIndex + 1]))
+				childIndex++;
+			first[holeIndex] = move(first[childIndex]);
+			holeIndex = childIndex;
+			childIndex = 2 * holeIndex + 1;
+		}
+		while(holeIndex > 0 && compare(first[(holeIndex - 1) / 2], lastData))
+		{
+			first[holeIndex] = move(first[(holeIndex - 1) / 2]);
+			holeIndex = (holeIndex - 1) / 2;
+		}
+		first[holeIndex] = move(lastData);
+	}
+}
+
+// helper of partialSort and nthElement: gathers the smallest middle - first items of
+// [first, last) into a heap at [first, middle)
+template<class RandomAccessIterator, class Compare>
+void heapSelect(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare& compare)
+{
+	typename iterator_traits<RandomAccessIterator>::difference_type count = middle - first;
+	heapMake(first, count, compare);
+	for(RandomAccessIterator current = middle; current < last; ++current)
+	{
+		if(compare(*current, *first)) // smaller than the biggest kept: swap it in
+		{
+			swap(*current, *first);
+			heapSiftDown(first, static_cast<decltype(count)>(0), count, compare);
+		}
+	}
+}
+
+template<class RandomAccessIterator, class Compare>
+void heapSort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+	typename iterator_traits<RandomAccessIterator>::difference_type count = last - first;
+	heapMake(first, count, compare);
+	heapSortHeap(first, count, compare);
+}
+
+template<class RandomAccessIterator>
+void heapSort(RandomAccessIterator first, RandomAccessIterator last)
+{
+	heapSort(first, last, less<typename iterator_traits<RandomAccessIterator>::value_type>());
+}
+
+template<class RandomAccessIterator, class Compare>
+void partialSort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare compare)
+{
+	if(first == middle)
+		return;
+
+	heapSelect(first, middle, last, compare);
+	heapSortHeap(first, middle - first, compare);
+}
+
+template<class RandomAccessIterator>
+void partialSort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+{
+	partialSort(first, middle, last, less<typename iterator_traits<RandomAccessIterator>::value_type>());
+}
+
+template<class RandomAccessIterator, class Compare>
+void nthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare)
+{
+	if(nth == last)
+		return;
+
+	// The biggest of the nth - first + 1 smallest items is the one for nth. When nth is in the
+	// back half, the same is done from the back with the order reversed, so the heap is smaller.
+	if(nth - first <= last - nth)
+	{
+		heapSelect(first, nth + 1, last, compare);
+		swap(*first, *nth); // the heap's top; what is left before nth is no bigger
+	}
+	else
+	{
+		typedef reverse_iterator<RandomAccessIterator> ReverseIterator;
+		ReversedCompare<Compare> greaterThan(compare);
+		heapSelect(ReverseIterator(last), ReverseIterator(nth), ReverseIterator(first), greaterThan);
+		swap(*(last - 1), *nth);
+	}
+}
+
+template<class RandomAccessIterator>
+void nthElement(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+	nthElement(first, nth, last, less<typename iterator_traits<RandomAccessIterator>::value_type>());
+}
+#endif // !_HEAP_H_
@@ -1,68 +1,963 @@
-// Heap_PriorityQueue.h
-#ifndef _HEAP_PRIORITY_QUEUE_H_
-#define _HEAP_PRIORITY_QUEUE_H_
-#include <stdexcept>
-#include "Heap.h"
-using namespace std;
-
-template<class ItemType>
-class PriorityQueueInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual bool add(const ItemType& newEntry) = 0;
-	virtual bool remove() = 0;
-	virtual ItemType peek() const = 0;
-};
-
-template<class ItemType>
-class Heap_PriorityQueue
-	: public PriorityQueueInterface<ItemType>,
-	  private ArrayMaxHeap<ItemType>
-{
-public:
-	Heap_PriorityQueue();
-	bool isEmpty() const;
-	bool add(const ItemType& newEntry);
-	bool remove();
-	ItemType peek() const;
-};
-
-//=================================================================================================
-// Heap_PriorityQueue
-//=================================================================================================
-template<class ItemType>
-Heap_PriorityQueue<ItemType>::Heap_PriorityQueue()
-{
-}
-
-template<class ItemType>
-bool Heap_PriorityQueue<ItemType>::isEmpty() const
-{
-	return ArrayMaxHeap<ItemType>::isEmpty();
-}
-
-template<class ItemType>
-bool Heap_PriorityQueue<ItemType>::add(const ItemType& newEntry)
-{
-	return ArrayMaxHeap<ItemType>::add(newEntry);
-}
-
-template<class ItemType>
-bool Heap_PriorityQueue<ItemType>::remove()
-{
-	return ArrayMaxHeap<ItemType>::remove();
-}
-
-template<class ItemType>
-ItemType Heap_PriorityQueue<ItemType>::peek() const
-{
-	try {
-		return ArrayMaxHeap<ItemType>::peekTop();
-	}
-	catch (logic_error e) {
-		throw logic_error("Precondition Violated Exception: peek() called with an empty priority queue.\n");
-	}
-
-}
-#endif // !_HEAP_PRIORITY_QUEUE_H_
+// Heap_PriorityQueue.h
+#ifndef _HEAP_PRIORITY_QUEUE_H_
+#define _HEAP_PRIORITY_QUEUE_H_
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "Heap.h"
+#include "KeyCompare.h"
+#include "PairingNode.h"
+using namespace std;
+
+#ifndef _PRIORITY_QUEUE_INTERFACE_
+#define _PRIORITY_QUEUE_INTERFACE_ // shared with the other PriorityQueue headers
+template<class ItemType>
+class PriorityQueueInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual bool add(const ItemType& newEntry) = 0;
+	virtual bool remove() = 0;
+	virtual ItemType peek() const = 0;
+};
+#endif // !_PRIORITY_QUEUE_INTERFACE_
+
+// The heap under Heap_PriorityQueue<ItemType, Compare, D>: ArrayMaxHeap when D is 2, DaryHeap otherwise
+template<class ItemType, class Compare, int D>
+struct MaxHeapOf
+{
+	typedef DaryHeap<ItemType, D, Compare> type;
+};
+
+template<class ItemType, class Compare>
+struct MaxHeapOf<ItemType, Compare, 2>
+{
+	typedef ArrayMaxHeap<ItemType, Compare> type;
+};
+
+// The BIGGER entry (by Compare) has the HIGHER priority;
+// Heap_PriorityQueue<ItemType, greater<ItemType> > serves the smallest first.
+// D is the number of children per heap node; see DaryHeap
+template<class ItemType, class Compare = less<ItemType>, int D = 2>
+class Heap_PriorityQueue
+	: public PriorityQueueInterface<ItemType>,
+	  private MaxHeapOf<ItemType, Compare, D>::type
+{
+private:
+	typedef typename MaxHeapOf<ItemType, Compare, D>::type HeapType;
+public:
+	Heap_PriorityQueue();
+	template<class InputIterator>
+	Heap_PriorityQueue(InputIterator first, InputIterator last);
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last); // replaces the contents, O(N)
+	void merge(Heap_PriorityQueue<ItemType, Compare, D>&& aPQ); // takes every entry of aPQ, O(N + M)
+	bool remove();
+	ItemType peek() const;
+};
+
+// Heap_PriorityQueue whose entries can be changed or taken out after adding them
+// (ex: decrease-key in Dijkstra, cancelling a timer) instead of adding duplicates.
+// insert() returns a Handle for the entry; see IndexedMaxHeap
+template<class ItemType, class Compare = less<ItemType> >
+class IndexedHeap_PriorityQueue
+	: public PriorityQueueInterface<ItemType>,
+	  private IndexedMaxHeap<ItemType, Compare>
+{
+private:
+	typedef IndexedMaxHeap<ItemType, Compare> HeapType;
+public:
+	typedef typename HeapType::Handle Handle;
+	IndexedHeap_PriorityQueue();
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	Handle insert(const ItemType& newEntry);
+	Handle insert(ItemType&& newEntry);
+	template<class... Args>
+	Handle emplace(Args&&... args);
+	bool contains(Handle handle) const;
+	ItemType getEntry(Handle handle) const;
+	bool updatePriority(Handle handle, const ItemType& newEntry); // moves the entry to its new place
+	bool updatePriority(Handle handle, ItemType&& newEntry);
+	bool erase(Handle handle);
+	bool remove();
+	ItemType peek() const;
+	Handle peekHandle() const;
+};
+
+// Pairing heap: a tree where no child is bigger than its parent, kept as first-child /
+// next-sibling chains. add() and raising an entry's priority are O(1) (the new or cut-off
+// tree is paired with the root); remove() pairs the root's children two by two, then
+// right to left, O(log N) amortized.
+// The BIGGER entry (by Compare) has the HIGHER priority, as in Heap_PriorityQueue.
+template<class ItemType, class Compare = less<ItemType> >
+class PairingHeap_PriorityQueue : public PriorityQueueInterface<ItemType>
+{
+public:
+	typedef PairingNode<ItemType>* Handle; // the entry's node; valid until the entry leaves the queue
+private:
+	PairingNode<ItemType>* rootPtr;
+	int itemCount;
+	Compare compare;
+	PairingNode<ItemType>* meld(PairingNode<ItemType>* firstRootPtr, PairingNode<ItemType>* secondRootPtr) const;
+	PairingNode<ItemType>* combineSiblings(PairingNode<ItemType>* firstSiblingPtr) const;
+	void cut(PairingNode<ItemType>* nodePtr); // detaches the subtree of a non-root node
+public:
+	PairingHeap_PriorityQueue();
+	template<class InputIterator>
+	PairingHeap_PriorityQueue(InputIterator first, InputIterator last);
+	PairingHeap_PriorityQueue(const PairingHeap_PriorityQueue<ItemType, Compare>& aPQ); // handles are not copied
+	PairingHeap_PriorityQueue(PairingHeap_PriorityQueue<ItemType, Compare>&& aPQ);
+	~PairingHeap_PriorityQueue();
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	Handle insert(const ItemType& newEntry);
+	Handle insert(ItemType&& newEntry);
+	template<class... Args>
+	Handle emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	void merge(PairingHeap_PriorityQueue<ItemType, Compare>&& aPQ); // O(1); the handles of aPQ stay valid here
+	ItemType getEntry(Handle handle) const;
+	bool updatePriority(Handle handle, const ItemType& newEntry);
+	bool updatePriority(Handle handle, ItemType&& newEntry);
+	bool erase(Handle handle);
+	bool remove();
+	ItemType peek() const;
+	Handle peekHandle() const;
+	void clear();
+	const PairingHeap_PriorityQueue<ItemType, Compare>& operator=(PairingHeap_PriorityQueue<ItemType, Compare>&& aPQ);
+};
+
+// Radix heap for monotone unsigned integer keys (ex: event timestamps): the key of a new entry
+// must not be smaller than the key of the last entry removed, or add() returns false.
+// The SMALLER key has the HIGHER priority. KeyOf gives the key of an entry (see KeyCompare.h).
+// Entries sit in bucket b when the highest bit where their key differs from the last removed key
+// is bit b - 1 (bucket 0: the same key). add() is O(1); when bucket 0 runs out, remove() spreads
+// the first nonempty bucket over the lower ones. An entry only ever moves down, so remove() is
+// O(log C) amortized for keys up to C, and no two entries are ever compared.
+template<class ItemType, class KeyOf = IdentityKey<ItemType> >
+class RadixHeap_PriorityQueue : public PriorityQueueInterface<ItemType>
+{
+private:
+	static const int BUCKET_COUNT = 65;
+	static const int DEFAULT_CAPACITY = 8;
+	struct Bucket
+	{
+		ItemType* items; // uninitialized past itemCount
+		int itemCount;
+		int maxItems;
+	};
+	Bucket buckets[BUCKET_COUNT];
+	unsigned long long lastKey; // the key of the last entry removed; bucket 0 holds the entries with this key
+	int itemCount;
+	int topBucket; // the entry peek() gives: buckets[topBucket].items[topIndex]
+	int topIndex;
+	KeyOf keyOf;
+	int bucketOf(unsigned long long key) const;
+	void pushInto(int bucketIndex, ItemType&& newEntry);
+	void refill(); // bucket 0 ran out: lastKey becomes the smallest key left, and its bucket is spread out
+	void findTop();
+public:
+	RadixHeap_PriorityQueue();
+	template<class InputIterator>
+	RadixHeap_PriorityQueue(InputIterator first, InputIterator last);
+	RadixHeap_PriorityQueue(const RadixHeap_PriorityQueue<ItemType, KeyOf>& aPQ);
+	RadixHeap_PriorityQueue(RadixHeap_PriorityQueue<ItemType, KeyOf>&& aPQ);
+	~RadixHeap_PriorityQueue();
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last); // false if an entry was turned down
+	void merge(RadixHeap_PriorityQueue<ItemType, KeyOf>&& aPQ); // O(M); keys from the smaller of the two last keys on are taken
+	bool remove();
+	ItemType peek() const;
+	void clear(); // also forgets the last removed key
+	const RadixHeap_PriorityQueue<ItemType, KeyOf>& operator=(RadixHeap_PriorityQueue<ItemType, KeyOf>&& aPQ);
+};
+
+//=================================================================================================
+// Heap_PriorityQueue
+//=================================================================================================
+template<class ItemType, class Compare, int D>
+Heap_PriorityQueue<ItemType, Compare, D>::Heap_PriorityQueue()
+{
+}
+
+template<class ItemType, class Compare, int D>
+template<class InputIterator>
+Heap_PriorityQueue<ItemType, Compare, D>::Heap_PriorityQueue(InputIterator first, InputIterator last)
+	: HeapType(first, last)
+{
+}
+
+template<class ItemType, class Compare, int D>
+bool Heap_PriorityQueue<ItemType, Compare, D>::isEmpty() const
+{
+	return HeapType::isEmpty();
+}
+
+template<class ItemType, class Compare, int D>
+bool Heap_PriorityQueue<ItemType, Compare, D>::add(const ItemType& newEntry)
+{
+	return HeapType::add(newEntry);
+}
+
+template<class ItemType, class Compare, int D>
+bool Heap_PriorityQueue<ItemType, Compare, D>::add(ItemType&& newEntry)
+{
+	return HeapType::add(move(newEntry));
+}
+
+template<class ItemType, class Compare, int D>
+template<class... Args>
+bool Heap_PriorityQueue<ItemType, Compare, D>::emplace(Args&&... args)
+{
+	return HeapType::emplace(forward<Args>(args)...);
+}
+
+template<class ItemType, class Compare, int D>
+template<class InputIterator>
+bool Heap_PriorityQueue<ItemType, Compare, D>::addAll(InputIterator first, InputIterator last)
+{
+	return HeapType::addAll(first, last);
+}
+
+template<class ItemType, class Compare, int D>
+template<class InputIterator>
+void Heap_PriorityQueue<ItemType, Compare, D>::assign(InputIterator first, InputIterator last)
+{
+	HeapType::assign(first, last);
+}
+
+template<class ItemType, class Compare, int D>
+void Heap_PriorityQueue<ItemType, Compare, D>::merge(Heap_PriorityQueue<ItemType, Compare, D>&& aPQ)
+{
+	HeapType::merge(static_cast<HeapType&&>(aPQ));
+}
+
+template<class ItemType, class Compare, int D>
+bool Heap_PriorityQueue<ItemType, Compare, D>::remove()
+{
+	return HeapType::remove();
+}
+
+template<class ItemType, class Compare, int D>
+ItemType Heap_PriorityQueue<ItemType, Compare, D>::peek() const
+{
+	try {
+		return HeapType::peekTop();
+	}
+	catch (logic_error e) {
+		throw logic_error("Precondition Violated Exception: peek() called with an empty priority queue.\n");
+	}
+
+}
+
+//=================================================================================================
+// IndexedHeap_PriorityQueue
+//=================================================================================================
+template<class ItemType, class Compare>
+IndexedHeap_PriorityQueue<ItemType, Compare>::IndexedHeap_PriorityQueue()
+{
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::isEmpty() const
+{
+	return HeapType::isEmpty();
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	return HeapType::add(newEntry);
+}
+
+template<class ItemType, class Compare>
+typename IndexedHeap_PriorityQueue<ItemType, Compare>::Handle IndexedHeap_PriorityQueue<ItemType, Compare>::insert(const ItemType& newEntry)
+{
+	return HeapType::insert(newEntry);
+}
+
+template<class ItemType, class Compare>
+typename IndexedHeap_PriorityQueue<ItemType, Compare>::Handle IndexedHeap_PriorityQueue<ItemType, Compare>::insert(ItemType&& newEntry)
+{
+	return HeapType::insert(move(newEntry));
+}
+
+template<class ItemType, class Compare>
+template<class... Args>
+typename IndexedHeap_PriorityQueue<ItemType, Compare>::Handle IndexedHeap_PriorityQueue<ItemType, Compare>::emplace(Args&&... args)
+{
+	return HeapType::emplace(forward<Args>(args)...);
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::contains(Handle handle) const
+{
+	return HeapType::contains(handle);
+}
+
+template<class ItemType, class Compare>
+ItemType IndexedHeap_PriorityQueue<ItemType, Compare>::getEntry(Handle handle) const
+{
+	return HeapType::getEntry(handle);
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::updatePriority(Handle handle, const ItemType& newEntry)
+{
+	return HeapType::updatePriority(handle, newEntry);
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::updatePriority(Handle handle, ItemType&& newEntry)
+{
+	return HeapType::updatePriority(handle, move(newEntry));
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::erase(Handle handle)
+{
+	return HeapType::erase(handle);
+}
+
+template<class ItemType, class Compare>
+bool IndexedHeap_PriorityQueue<ItemType, Compare>::remove()
+{
+	return HeapType::remove();
+}
+
+template<class ItemType, class Compare>
+ItemType IndexedHeap_PriorityQueue<ItemType, Compare>::peek() const
+{
+	if(HeapType::isEmpty())
+		throw logic_error("Precondition Violated Exception: peek() called with an empty priority queue.\n");
+
+	return HeapType::peekTop();
+}
+
+template<class ItemType, class Compare>
+typename IndexedHeap_PriorityQueue<ItemType, Compare>::Handle IndexedHeap_PriorityQueue<ItemType, Compare>::peekHandle() const
+{
+	if(HeapType::isEmpty())
+		throw logic_error("Precondition Violated Exception: peekHandle() called with an empty priority queue.\n");
+
+	return HeapType::peekTopHandle();
+}
+
+//=================================================================================================
+// PairingHeap_PriorityQueue
+//=================================================================================================
+template<class ItemType, class Compare>
+PairingHeap_PriorityQueue<ItemType, Compare>::PairingHeap_PriorityQueue() : rootPtr(nullptr), itemCount(0)
+{
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+PairingHeap_PriorityQueue<ItemType, Compare>::PairingHeap_PriorityQueue(InputIterator first, InputIterator last)
+	: rootPtr(nullptr), itemCount(0)
+{
+	addAll(first, last);
+}
+
+template<class ItemType, class Compare>
+PairingHeap_PriorityQueue<ItemType, Compare>::PairingHeap_PriorityQueue(const PairingHeap_PriorityQueue<ItemType, Compare>& aPQ)
+	: rootPtr(nullptr), itemCount(0)
+{
+	// preorder walk without a stack: a first child's prevPtr is its parent
+	const PairingNode<ItemType>* curPtr = aPQ.rootPtr;
+	while(curPtr != nullptr)
+	{
+		emplace(curPtr->item);
+		if(curPtr->childPtr != nullptr)
+			curPtr = curPtr->childPtr;
+		else
+		{
+			while((curPtr != nullptr) && (curPtr->siblingPtr == nullptr)) // climb to the parent
+			{
+				while((curPtr->prevPtr != nullptr) && (curPtr->prevPtr->childPtr != curPtr))
+					curPtr = curPtr->prevPtr;
+				curPtr = curPtr->prevPtr;
+			}
+			if(curPtr != nullptr)
+				curPtr = curPtr->siblingPtr;
+		}
+	}
+}
+
+template<class ItemType, class Compare>
+PairingHeap_PriorityQueue<ItemType, Compare>::PairingHeap_PriorityQueue(PairingHeap_PriorityQueue<ItemType, Compare>&& aPQ)
+	: rootPtr(aPQ.rootPtr), itemCount(aPQ.itemCount)
+{
+	aPQ.rootPtr = nullptr;
+	aPQ.itemCount = 0;
+}
+
+template<class ItemType, class Compare>
+PairingHeap_PriorityQueue<ItemType, Compare>::~PairingHeap_PriorityQueue()
+{
+	clear();
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::isEmpty() const
+{
+	return (rootPtr == nullptr);
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	emplace(newEntry);
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::add(ItemType&& newEntry)
+{
+	emplace(move(newEntry));
+	return true;
+}
+
+template<class ItemType, class Compare>
+typename PairingHeap_PriorityQueue<ItemType, Compare>::Handle PairingHeap_PriorityQueue<ItemType, Compare>::insert(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType, class Compare>
+typename PairingHeap_PriorityQueue<ItemType, Compare>::Handle PairingHeap_PriorityQueue<ItemType, Compare>::insert(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType, class Compare>
+template<class... Args>
+typename PairingHeap_PriorityQueue<ItemType, Compare>::Handle PairingHeap_PriorityQueue<ItemType, Compare>::emplace(Args&&... args)
+{
+	PairingNode<ItemType>* newNodePtr = new PairingNode<ItemType>(forward<Args>(args)...);
+	rootPtr = meld(rootPtr, newNodePtr);
+	itemCount++;
+	return newNodePtr;
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::addAll(InputIterator first, InputIterator last)
+{
+	for(; first != last; ++first)
+		emplace(*first);
+	return true;
+}
+
+template<class ItemType, class Compare>
+void PairingHeap_PriorityQueue<ItemType, Compare>::merge(PairingHeap_PriorityQueue<ItemType, Compare>&& aPQ)
+{
+	if(this == &aPQ)
+		return;
+
+	rootPtr = meld(rootPtr, aPQ.rootPtr);
+	itemCount += aPQ.itemCount;
+	aPQ.rootPtr = nullptr;
+	aPQ.itemCount = 0;
+}
+
+template<class ItemType, class Compare>
+ItemType PairingHeap_PriorityQueue<ItemType, Compare>::getEntry(Handle handle) const
+{
+	if(handle == nullptr)
+		throw logic_error("Precondition Violated Exception: getEntry() called with a null handle.\n");
+
+	return handle->item;
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::updatePriority(Handle handle, const ItemType& newEntry)
+{
+	return updatePriority(handle, ItemType(newEntry));
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::updatePriority(Handle handle, ItemType&& newEntry)
+{
+	if(handle == nullptr)
+		return false;
+
+	bool raised = compare(handle->item, newEntry);
+	handle->item = move(newEntry);
+	if(raised)
+	{
+		// still no bigger than its children; only its parent may be smaller now
+		if(handle != rootPtr)
+		{
+			cut(handle);
+			rootPtr = meld(rootPtr, handle);
+		}
+	}
+	else if(handle->childPtr != nullptr)
+	{
+		// still no bigger than its parent; only its children may be bigger now
+		PairingNode<ItemType>* childrenPtr = handle->childPtr;
+		handle->childPtr = nullptr;
+		rootPtr = meld(rootPtr, combineSiblings(childrenPtr));
+	}
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::erase(Handle handle)
+{
+	if(handle == nullptr)
+		return false;
+	if(handle == rootPtr)
+		return remove();
+
+	cut(handle);
+	rootPtr = meld(rootPtr, combineSiblings(handle->childPtr));
+	delete handle;
+	itemCount--;
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool PairingHeap_PriorityQueue<ItemType, Compare>::remove()
+{
+	if(isEmpty())
+		return false;
+
+	PairingNode<ItemType>* oldRootPtr = rootPtr;
+	rootPtr = combineSiblings(rootPtr->childPtr);
+	delete oldRootPtr;
+	itemCount--;
+	return true;
+}
+
+template<class ItemType, class Compare>
+ItemType PairingHeap_PriorityQueue<ItemType, Compare>::peek() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peek() called with an empty priority queue.\n");
+
+	return rootPtr->item;
+}
+
+template<class ItemType, class Compare>
+typename PairingHeap_PriorityQueue<ItemType, Compare>::Handle PairingHeap_PriorityQueue<ItemType, Compare>::peekHandle() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peekHandle() called with an empty priority queue.\n");
+
+	return rootPtr;
+}
+
+template<class ItemType, class Compare>
+void PairingHeap_PriorityQueue<ItemType, Compare>::clear()
+{
+	// no recursion (the tree can be N deep): each node's children are spliced
+	// in front of the siblings still to be deleted
+	PairingNode<ItemType>* curPtr = rootPtr;
+	while(curPtr != nullptr)
+	{
+		if(curPtr->childPtr != nullptr)
+		{
+			PairingNode<ItemType>* lastChildPtr = curPtr->childPtr;
+			while(lastChildPtr->siblingPtr != nullptr)
+				lastChildPtr = lastChildPtr->siblingPtr;
+			lastChildPtr->siblingPtr = curPtr->siblingPtr;
+			curPtr->siblingPtr = curPtr->childPtr;
+		}
+		PairingNode<ItemType>* nodeToDeletePtr = curPtr;
+		curPtr = curPtr->siblingPtr;
+		delete nodeToDeletePtr;
+	}
+	rootPtr = nullptr;
+	itemCount = 0;
+}
+
+template<class ItemType, class Compare>
+const PairingHeap_PriorityQueue<ItemType, Compare>& PairingHeap_PriorityQueue<ItemType, Compare>::operator=(PairingHeap_PriorityQueue<ItemType, Compare>&& aPQ)
+{
+	if(this != &aPQ)
+	{
+		clear();
+		rootPtr = aPQ.rootPtr;
+		itemCount = aPQ.itemCount;
+		aPQ.rootPtr = nullptr;
+		aPQ.itemCount = 0;
+	}
+	return *this;
+}
+
+// private member function of PairingHeap_PriorityQueue
+// The smaller root becomes the first child of the bigger one
+template<class ItemType, class Compare>
+PairingNode<ItemType>* PairingHeap_PriorityQueue<ItemType, Compare>::meld(PairingNode<ItemType>* firstRootPtr, PairingNode<ItemType>* secondRootPtr) const
+{
+	if(firstRootPtr == nullptr)
+		return secondRootPtr;
+	if(secondRootPtr == nullptr)
+		return firstRootPtr;
+
+	if(compare(firstRootPtr->item, secondRootPtr->item))
+		swap(firstRootPtr, secondRootPtr);
+	secondRootPtr->siblingPtr = firstRootPtr->childPtr;
+	if(firstRootPtr->childPtr != nullptr)
+		firstRootPtr->childPtr->prevPtr = secondRootPtr;
+	secondRootPtr->prevPtr = firstRootPtr;
+	firstRootPtr->childPtr = secondRootPtr;
+	return firstRootPtr;
+}
+
+// private member function of PairingHeap_PriorityQueue
+// Two-pass pairing of a sibling chain into one tree: meld the siblings in pairs from
+// left to right, then meld the pairs from right to left.
+template<class ItemType, class Compare>
+PairingNode<ItemType>* PairingHeap_PriorityQueue<ItemType, Compare>::combineSiblings(PairingNode<ItemType>* firstSiblingPtr) const
+{
+	// first pass; the pairs are chained through siblingPtr in reverse order
+	PairingNode<ItemType>* pairsPtr = nullptr;
+	while(firstSiblingPtr != nullptr)
+	{
+		PairingNode<ItemType>* firstPtr = firstSiblingPtr;
+		PairingNode<ItemType>* secondPtr = firstPtr->siblingPtr;
+		firstSiblingPtr = (secondPtr != nullptr) ? secondPtr->siblingPtr : nullptr;
+		firstPtr->siblingPtr = nullptr;
+		firstPtr->prevPtr = nullptr;
+		if(secondPtr != nullptr)
+		{
+			secondPtr->siblingPtr = nullptr;
+			secondPtr->prevPtr = nullptr;
+			firstPtr = meld(firstPtr, secondPtr);
+		}
+		firstPtr->siblingPtr = pairsPtr;
+		pairsPtr = firstPtr;
+	}
+
+	// second pass
+	PairingNode<ItemType>* resultPtr = nullptr;
+	while(pairsPtr != nullptr)
+	{
+		PairingNode<ItemType>* nextPairPtr = pairsPtr->siblingPtr;
+		pairsPtr->siblingPtr = nullptr;
+		resultPtr = meld(resultPtr, pairsPtr);
+		pairsPtr = nextPairPtr;
+	}
+	return resultPtr;
+}
+
+// private member function of PairingHeap_PriorityQueue
+template<class ItemType, class Compare>
+void PairingHeap_PriorityQueue<ItemType, Compare>::cut(PairingNode<ItemType>* nodePtr)
+{
+	if(nodePtr->prevPtr->childPtr == nodePtr) // a first child
+		nodePtr->prevPtr->childPtr = nodePtr->siblingPtr;
+	else
+		nodePtr->prevPtr->siblingPtr = nodePtr->siblingPtr;
+	if(nodePtr->siblingPtr != nullptr)
+		nodePtr->siblingPtr->prevPtr = nodePtr->prevPtr;
+	nodePtr->prevPtr = nullptr;
+	nodePtr->siblingPtr = nullptr;
+}
+
+//=================================================================================================
+// RadixHeap_PriorityQueue
+//=================================================================================================
+template<class ItemType, class KeyOf>
+RadixHeap_PriorityQueue<ItemType, KeyOf>::RadixHeap_PriorityQueue() : lastKey(0), itemCount(0), topBucket(0), topIndex(0)
+{
+	for(int b = 0; b < BUCKET_COUNT; b++)
+	{
+		buckets[b].items = nullptr;
+		buckets[b].itemCount = 0;
+		buckets[b].maxItems = 0;
+	}
+}
+
+template<class ItemType, class KeyOf>
+template<class InputIterator>
+RadixHeap_PriorityQueue<ItemType, KeyOf>::RadixHeap_PriorityQueue(InputIterator first, InputIterator last)
+	: RadixHeap_PriorityQueue()
+{
+	addAll(first, last);
+}
+
+template<class ItemType, class KeyOf>
+RadixHeap_PriorityQueue<ItemType, KeyOf>::RadixHeap_PriorityQueue(const RadixHeap_PriorityQueue<ItemType, KeyOf>& aPQ)
+	: lastKey(aPQ.lastKey), itemCount(aPQ.itemCount), topBucket(aPQ.topBucket), topIndex(aPQ.topIndex)
+{
+	for(int b = 0; b < BUCKET_COUNT; b++)
+	{
+		buckets[b].itemCount = aPQ.buckets[b].itemCount;
+		buckets[b].maxItems = aPQ.buckets[b].itemCount;
+		buckets[b].items = allocateItems<ItemType>(buckets[b].maxItems);
+		copyItems(buckets[b].items, aPQ.buckets[b].items, buckets[b].itemCount);
+	}
+}
+
+template<class ItemType, class KeyOf>
+RadixHeap_PriorityQueue<ItemType, KeyOf>::RadixHeap_PriorityQueue(RadixHeap_PriorityQueue<ItemType, KeyOf>&& aPQ)
+	: lastKey(aPQ.lastKey), itemCount(aPQ.itemCount), topBucket(aPQ.topBucket), topIndex(aPQ.topIndex)
+{
+	for(int b = 0; b < BUCKET_COUNT; b++)
+	{
+		buckets[b] = aPQ.buckets[b];
+		aPQ.buckets[b].items = nullptr;
+		aPQ.buckets[b].itemCount = 0;
+		aPQ.buckets[b].maxItems = 0;
+	}
+	aPQ.lastKey = 0;
+	aPQ.itemCount = 0;
+}
+
+template<class ItemType, class KeyOf>
+RadixHeap_PriorityQueue<ItemType, KeyOf>::~RadixHeap_PriorityQueue()
+{
+	for(int b = 0; b < BUCKET_COUNT; b++)
+	{
+		destroyItems(buckets[b].items, 0, buckets[b].itemCount);
+		freeItems(buckets[b].items);
+	}
+}
+
+template<class ItemType, class KeyOf>
+bool RadixHeap_PriorityQueue<ItemType, KeyOf>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, class KeyOf>
+bool RadixHeap_PriorityQueue<ItemType, KeyOf>::add(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType, class KeyOf>
+bool RadixHeap_PriorityQueue<ItemType, KeyOf>::add(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType, class KeyOf>
+template<class... Args>
+bool RadixHeap_PriorityQueue<ItemType, KeyOf>::emplace(Args&&... args)
+{
+	ItemType newEntry(forward<Args>(args)...);
+	unsigned long long key = keyOf(newEntry);
+	if(key < lastKey) // would go before an entry already removed
+		return false;
+
+	int bucketIndex = bucketOf(key);
+	pushInto(bucketIndex, move(newEntry));
+	// on a tie the newest entry is the top: it is the one refill() leaves at the back of bucket 0
+	if(isEmpty() || key <= keyOf(buckets[topBucket].items[topIndex]))
+	{
+		topBucket = bucketIndex;
+		topIndex = buckets[bucketIndex].itemCount - 1;
+	}
+	itemCount++;
+	return true;
+}
+
+template<class ItemType, class KeyOf>
+template<class InputIterator>
+bool RadixHeap_PriorityQueue<ItemType, KeyOf>::addAll(InputIterator first, InputIterator last)
+{
+	bool allAdded = true;
+	for(; first != last; ++first)
+	{
+		if(!emplace(*first))
+			allAdded = false;
+	}
+	return allAdded;
+}
+
+template<class ItemType, class KeyOf>
+void RadixHeap_PriorityQueue<ItemType, KeyOf>::merge(RadixHeap_PriorityQueue<ItemType, KeyOf>&& aPQ)
+{
+	if(this == &aPQ)
+		return;
+
+	// keep the queue with the smaller last key; its buckets can hold the keys of both
+	if(aPQ.lastKey < lastKey)
+	{
+		for(int b = 0; b < BUCKET_COUNT; b++)
+			swap(buckets[b], aPQ.buckets[b]);
+		swap(lastKey, aPQ.lastKey);
+		swap(itemCount, aPQ.itemCount);
+	}
+	for(int b = 0; b < BUCKET_COUNT; b++)
+	{
+		Bucket& bucket = aPQ.buckets[b];
+		for(int i = 0; i < bucket.itemCount; i++)
+			pushInto(bucketOf(keyOf(bucket.items[i])), move(bucket.items[i]));
+		destroyItems(bucket.items, 0, bucket.itemCount);
+		bucket.itemCount = 0;
+	}
+	itemCount += aPQ.itemCount;
+	aPQ.itemCount = 0;
+	aPQ.lastKey = 0;
+	if(!isEmpty())
+		findTop();
+}
+
+template<class ItemType, class KeyOf>
+bool RadixHeap_PriorityQueue<ItemType, KeyOf>::remove()
+{
+	if(isEmpty())
+		return false;
+
+	if(buckets[0].itemCount == 0)
+		refill();
+	Bucket& firstBucket = buckets[0];
+	firstBucket.itemCount--; // the top
+	destroyItems(firstBucket.items, firstBucket.itemCount, firstBucket.itemCount + 1);
+	itemCount--;
+	if(!isEmpty())
+		findTop();
+	return true;
+}
+
+template<class ItemType, class KeyOf>
+ItemType RadixHeap_PriorityQueue<ItemType, KeyOf>::peek() const
+{
+	if(isEmpty())
+		throw logic_error("Precondition Violated Exception: peek() called with an empty priority queue.\n");
+
+	return buckets[topBucket].items[topIndex];
+}
+
+template<class ItemType, class KeyOf>
+void RadixHeap_PriorityQueue<ItemType, KeyOf>::clear()
+{
+	for(int b = 0; b < BUCKET_COUNT; b++)
+	{
+		destroyItems(buckets[b].items, 0, buckets[b].itemCount);
+		buckets[b].itemCount = 0;
+	}
+	lastKey = 0;
+	itemCount = 0;
+}
+
+template<class ItemType, class KeyOf>
+const RadixHeap_PriorityQueue<ItemType, KeyOf>& RadixHeap_PriorityQueue<ItemType, KeyOf>::operator=(RadixHeap_PriorityQueue<ItemType, KeyOf>&& aPQ)
+{
+	if(this != &aPQ)
+	{
+		for(int b = 0; b < BUCKET_COUNT; b++)
+		{
+			destroyItems(buckets[b].items, 0, buckets[b].itemCount);
+			freeItems(buckets[b].items);
+			buckets[b] = aPQ.buckets[b];
+			aPQ.buckets[b].items = nullptr;
+			aPQ.buckets[b].itemCount = 0;
+			aPQ.buckets[b].maxItems = 0;
+		}
+		lastKey = aPQ.lastKey;
+		itemCount = aPQ.itemCount;
+		topBucket = aPQ.topBucket;
+		topIndex = aPQ.topIndex;
+		aPQ.lastKey = 0;
+		aPQ.itemCount = 0;
+	}
+	return *this;
+}
+
+// private member function of RadixHeap_PriorityQueue
+template<class ItemType, class KeyOf>
+int RadixHeap_PriorityQueue<ItemType, KeyOf>::bucketOf(unsigned long long key) const
+{
+	unsigned long long diff = key ^ lastKey;
+	if(diff == 0)
+		return 0;
+#if defined(__GNUC__)
+	return 64 - __builtin_clzll(diff);
+#else
+	int bucketIndex = 0;
+	for(; diff != 0; diff >>= 1)
+		bucketIndex++;
+	return bucketIndex;
+#endif
+}
+
+// private member function of RadixHeap_PriorityQueue
+template<class ItemType, class KeyOf>
+void RadixHeap_PriorityQueue<ItemType, KeyOf>::pushInto(int bucketIndex, ItemType&& newEntry)
+{
+	Bucket& bucket = buckets[bucketIndex];
+	if(bucket.itemCount == bucket.maxItems)
+	{
+		int newCapacity = (bucket.maxItems > 0) ? 2 * bucket.maxItems : DEFAULT_CAPACITY;
+		bucket.items = reallocateItems(bucket.items, bucket.itemCount, newCapacity);
+		bucket.maxItems = newCapacity;
+	}
+	new (&bucket.items[bucket.itemCount]) ItemType(move(newEntry));
+	bucket.itemCount++;
+}
+
+// private member function of RadixHeap_PriorityQueue
+// The top is the back of bucket 0, or else the last entry with the smallest key in the first
+// nonempty bucket (the one refill() will put at the back of bucket 0)
+template<class ItemType, class KeyOf>
+void RadixHeap_PriorityQueue<ItemType, KeyOf>::findTop()
+{
+	int b = 0;
+	while(buckets[b].itemCount == 0)
+		b++;
+
+	Bucket& bucket = buckets[b];
+	topBucket = b;
+	topIndex = bucket.itemCount - 1;
+	if(b == 0)
+		return;
+	unsigned long long smallestKey = keyOf(bucket.items[topIndex]);
+	for(int i = bucket.itemCount - 2; i >= 0; i--)
+	{
+		unsigned long long key = keyOf(bucket.items[i]);
+		if(key < smallestKey)
+		{
+			smallestKey = key;
+			topIndex = i;
+		}
+	}
+}
+
+// private member function of RadixHeap_PriorityQueue
+// Every key in bucket b agrees with lastKey above bit b - 1, and so does the new lastKey (the
+// smallest of them); so each entry lands in a bucket below b.
+template<class ItemType, class KeyOf>
+void RadixHeap_PriorityQueue<ItemType, KeyOf>::refill()
+{
+	int b = 1;
+	while(buckets[b].itemCount == 0)
+		b++;
+
+	Bucket& bucket = buckets[b];
+	unsigned long long smallestKey = keyOf(bucket.items[0]);
+	for(int i = 1; i < bucket.itemCount; i++)
+	{
+		unsigned long long key = keyOf(bucket.items[i]);
+		if(key < smallestKey)
+			smallestKey = key;
+	}
+
+	lastKey = smallestKey;
+	for(int i = 0; i < bucket.itemCount; i++)
+		pushInto(bucketOf(keyOf(bucket.items[i])), move(bucket.items[i]));
+	destroyItems(bucket.items, 0, bucket.itemCount);
+	bucket.itemCount = 0;
+}
+#endif // !_HEAP_PRIORITY_QUEUE_H_
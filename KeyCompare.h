@@ -0,0 +1,45 @@
+// KeyCompare.h
+// Comparators that order items by a key read from each of them, so only the keys are compared.
+// They plug into the Compare parameter of ArrayMaxHeap, Heap_PriorityQueue, the sorted lists
+// and BinarySearchTree. The KeyOf objects below also give the keys of RadixHeap_PriorityQueue.
+// ex: struct Task { int priority; string name; };
+//     Heap_PriorityQueue<Task, KeyCompare<Task, MemberKey<Task, int, &Task::priority> > > tasks;
+#ifndef _KEY_COMPARE_H_
+#define _KEY_COMPARE_H_
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// KeyOf turns an item into its key; the keys are ordered by Compare (operator< by default)
+template<class ItemType, class KeyOf,
+		 class Compare = std::less<typename std::decay<decltype(std::declval<KeyOf>()(std::declval<const ItemType&>()))>::type> >
+struct KeyCompare
+{
+	KeyOf keyOf;
+	Compare compare;
+	bool operator()(const ItemType& leftItem, const ItemType& rightItem) const
+	{
+		return compare(keyOf(leftItem), keyOf(rightItem));
+	}
+};
+
+// KeyOf for items that are their own key
+template<class ItemType>
+struct IdentityKey
+{
+	const ItemType& operator()(const ItemType& anItem) const
+	{
+		return anItem;
+	}
+};
+
+// KeyOf that reads the data member Member of an item
+template<class ItemType, class KeyType, KeyType ItemType::*Member>
+struct MemberKey
+{
+	const KeyType& operator()(const ItemType& anItem) const
+	{
+		return anItem.*Member;
+	}
+};
+#endif // !_KEY_COMPARE_H_
@@ -1,314 +1,1730 @@
-// List.h
-#ifndef _LIST_H_
-#define _LIST_H_
-#include <stdexcept>
-#include "Node.h"
-using namespace std;
-
-template<class ItemType>
-class ListInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual int getLength() const = 0;
-	virtual bool insert(int newPosition, const ItemType& newEntry) = 0;
-	virtual bool remove(int position) = 0;
-	virtual void clear() = 0;
-	virtual ItemType getEntry(int position) const = 0;
-	virtual void setEntry(int position, const ItemType& newEntry) = 0;
-};
-
-template<class ItemType>
-class LinkedList : public ListInterface<ItemType>
-{
-private:
-	Node<ItemType>* headPtr;
-	int itemCount;
-
-	Node<ItemType>* getNodeAt(int position) const;
-public:
-	LinkedList();
-	LinkedList(const LinkedList<ItemType>& aList);
-	~LinkedList();
-	bool isEmpty() const;
-	int getLength() const;
-	bool insert(int newPosition, const ItemType& newEntry);
-	bool remove(int position);
-	void clear();
-	ItemType getEntry(int position) const;
-	void setEntry(int position, const ItemType& newEntry);
-};
-
-template<class ItemType>
-class ArrayList : public ListInterface<ItemType>
-{
-private:
-	static const int DEFAULT_CAPACITY = 100;
-	ItemType* items;
-	int itemCount;
-	int maxItems;
-public:
-	ArrayList();
-	ArrayList(const ArrayList& aList);
-	~ArrayList();
-	bool isEmpty() const;
-	int getLength() const;
-	bool insert(int newPosition, const ItemType& newEntry);
-	bool remove(int position);
-	void clear();
-	ItemType getEntry(int position) const;
-	void setEntry(int position, const ItemType& newEntry);
-};
-
-//=================================================================================================
-// LinkedList
-//=================================================================================================
-template<class ItemType>
-LinkedList<ItemType>::LinkedList() : headPtr(nullptr), itemCount(0)
-{
-}
-
-template<class ItemType>
-LinkedList<ItemType>::LinkedList(const LinkedList<ItemType>& aList)
-{
-	itemCount = aList.itemCount;
-	Node<ItemType>* origChainPtr = aList.headPtr; // Points to nodes in original chain
-
-	if (origChainPtr == nullptr)
-		headPtr = nullptr;  // Original bag is empty; so is copy
-	else
-	{
-		// Copy first node
-		headPtr = new Node<ItemType>(origChainPtr->item);
-
-		// Copy remaining nodes
-		Node<ItemType>* newChainPtr = headPtr;
-		origChainPtr = origChainPtr->next;
-		while (origChainPtr != nullptr)
-		{
-			newChainPtr->next = new Node<ItemType>(origChainPtr->item);
-			newChainPtr = newChainPtr->next;
-			origChainPtr = origChainPtr->next;
-		}
-
-		newChainPtr->next = nullptr; // Flag end of new chain
-	}
-}
-
-template<class ItemType>
-LinkedList<ItemType>::~LinkedList()
-{
-	clear();
-}
-
-template<class ItemType>
-bool LinkedList<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<class ItemType>
-int LinkedList<ItemType>::getLength() const
-{
-	return itemCount;
-}
-
-template<class ItemType>
-bool LinkedList<ItemType>::insert(int newPosition, const ItemType& newEntry)
-{
-	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
-	if(ableToInsert)
-	{	//create a new node
-		Node<ItemType>* newNodePtr = new Node<ItemType>(newEntry);
-		// attach new node to chain
-		if(newPosition == 1)
-		{
-			newNodePtr->next = headPtr;
-			headPtr = newNodePtr;
-		}
-		else
-		{
-			Node<ItemType>* prevNodePtr = getNodeAt(newPosition - 1);
-			newNodePtr->next = prevNodePtr->next;
-			prevNodePtr->next = newNodePtr;
-		}
-		itemCount++;
-	}
-	return ableToInsert;
-}
-
-template<class ItemType>
-bool LinkedList<ItemType>::remove(int position)
-{
-	bool ableToRemove = (1 <= position) && (position <= itemCount);
-	if(ableToRemove)
-	{
-		Node<ItemType>* curPtr = nullptr;
-		if(position == 1)
-		{
-			curPtr = headPtr;
-			headPtr = headPtr->next;
-		}
-		else
-		{
-			Node<ItemType>* prevNodePtr = getNodeAt(position - 1);
-			curPtr = prevNodePtr->next;
-			prevNodePtr->next = curPtr->next;
-		}
-		curPtr->next = nullptr;
-		delete curPtr;
-		curPtr = nullptr;
-		itemCount--;
-	}
-	return ableToRemove;
-}
-
-template<class ItemType>
-void LinkedList<ItemType>::clear()
-{
-	while(!isEmpty())
-		remove(1);
-}
-
-template<class ItemType>
-ItemType LinkedList<ItemType>::getEntry(int position) const
-{
-	bool ableToGet = (1 <= position) && (position <= itemCount);
-	if(ableToGet)
-	{
-		Node<ItemType>* nodePtr = getNodeAt(position);
-		return nodePtr->item;
-	}
-	else
-		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
-}
-
-template<class ItemType>
-void LinkedList<ItemType>::setEntry(int position, const ItemType& newEntry)
-{
-	bool ableToSet = (1 <= position) && (position <= itemCount);
-	if(ableToSet)
-	{
-		Node<ItemType>* nodePtr = getNodeAt(position);
-		nodePtr->item = newEntry;
-	}
-	else
-		throw logic_error("Precondition Violated Exception: setEntry() called with an empty list or invalid position.\n");
-}
-
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::getNodeAt(int position) const
-{
-	if((position < 1) && (position > itemCount))
-		throw out_of_range("out_of_range exception called at getNodeAt()\n");
-
-	Node<ItemType>* curPtr = headPtr;
-	for (int i = 1; i < position; i++)
-		curPtr = curPtr->next;
-	return curPtr;
-}
-
-//=================================================================================================
-// ArrayList
-//=================================================================================================
-template<class ItemType>
-ArrayList<ItemType>::ArrayList() : itemCount(0), maxItems(DEFAULT_CAPACITY)
-{
-	items = new ItemType[maxItems];
-}
-
-template<class ItemType>
-ArrayList<ItemType>::ArrayList(const ArrayList& aList)
-{
-	itemCount = aList.itemCount;
-	maxItems = aList.maxItems;
-	items = new ItemType[maxItems];
-	for (int i = 0; i < itemCount; i++) {
-		items[i] = aList.items[i];
-	}
-}
-
-template<class ItemType>
-ArrayList<ItemType>::~ArrayList()
-{
-	delete[] items;
-}
-
-template<class ItemType>
-bool ArrayList<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<class ItemType>
-int ArrayList<ItemType>::getLength() const
-{
-	return itemCount;
-}
-
-template<class ItemType>
-bool ArrayList<ItemType>::insert(int newPosition, const ItemType& newEntry)
-{
-	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
-	if(ableToInsert)
-	{
-		bool hasRoomToAdd = (itemCount < maxItems);
-		if(!hasRoomToAdd)
-		{
-			ItemType* oldArray = items;
-			items = new ItemType[2 * maxItems];
-			for(int i = 0; i < maxItems; i++)
-				items[i] = oldArray[i];
-			delete[] oldArray;
-			maxItems *= 2;
-		}
-		// make room for new item by shifting
-		for(int i = itemCount; i >= newPosition; i--)
-			items[i] = items[i - 1];
-		// insert new item
-		items[newPosition - 1] = newEntry;
-		itemCount++; // increase the size of the list by one
-	}
-	return ableToInsert;
-}
-
-template<class ItemType>
-bool ArrayList<ItemType>::remove(int position)
-{
-	bool ableToRemove = (1 <= position) && (position <= itemCount);
-	if(ableToRemove)
-	{
-		// delete item by shifting
-		for(int i = position; i < itemCount; i++)
-			items[i - 1] = items[i];
-		itemCount--; // decrease count of entries
-	}
-	return ableToRemove;
-}
-
-template<class ItemType>
-void ArrayList<ItemType>::clear()
-{
-	itemCount = 0;
-}
-
-template<class ItemType>
-ItemType ArrayList<ItemType>::getEntry(int position) const
-{
-	bool ableToGet = (1 <= position) && (position <= itemCount);
-	if(ableToGet)
-		return items[position - 1];
-	else
-		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
-}
-
-template<class ItemType>
-void ArrayList<ItemType>::setEntry(int position, const ItemType& newEntry)
-{
-	bool ableToSet = (1 <= position) && (position <= itemCount);
-	if(ableToSet)
-		items[position - 1] = newEntry;
-	else
-		throw logic_error("Precondition Violated Exception: setEntry() called with an empty list or invalid position.\n");
-}
-#endif // !_LIST_H_
+// List.h
+#ifndef _LIST_H_
+#define _LIST_H_
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "Node.h"
+#include "TreapNode.h"
+#include "ArrayStorage.h"
+using namespace std;
+
+template<class ItemType>
+class ListInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual int getLength() const = 0;
+	virtual bool insert(int newPosition, const ItemType& newEntry) = 0;
+	virtual bool remove(int position) = 0;
+	virtual void clear() = 0;
+	virtual ItemType getEntry(int position) const = 0;
+	virtual void setEntry(int position, const ItemType& newEntry) = 0;
+};
+
+template<class ItemType, class Allocator = NodeAllocator<ItemType> >
+class LinkedList : public ListInterface<ItemType>
+{
+private:
+	Node<ItemType>* headPtr;
+	int itemCount;
+	Allocator nodeAlloc; // source of the nodes (ex: NodePool<ItemType>)
+
+	Node<ItemType>* getNodeAt(int position) const;
+public:
+	typedef NodeIterator<ItemType> iterator;
+	typedef NodeIterator<ItemType, const ItemType> const_iterator;
+
+	// A place in the list, to walk it once and edit as you go: insertAfter() and removeAfter()
+	// are O(1) at the cursor, where insert() and remove() walk from headPtr to the position.
+	// A cursor stays valid until the item at the cursor is removed.
+	class Cursor
+	{
+	private:
+		LinkedList<ItemType, Allocator>* listPtr;
+		Node<ItemType>* curPtr; // the item at the cursor; nullptr before the first item
+
+		Cursor(LinkedList<ItemType, Allocator>* aListPtr, Node<ItemType>* nodePtr);
+		Node<ItemType>*& nextLink() const; // the pointer to the item after the cursor
+		friend class LinkedList<ItemType, Allocator>;
+	public:
+		bool hasNext() const;        // is there an item after the cursor
+		bool advance();              // moves to the next item; false at the last one
+		ItemType& getEntry() const;  // the item at the cursor
+		bool insertAfter(const ItemType& newEntry); // the cursor stays where it is
+		bool insertAfter(ItemType&& newEntry);
+		template<class... Args>
+		bool emplaceAfter(Args&&... args);
+		bool removeAfter();          // false if there is no item after the cursor
+	};
+
+	LinkedList();
+	template<class InputIterator>
+	LinkedList(InputIterator first, InputIterator last);
+	LinkedList(const LinkedList<ItemType, Allocator>& aList);
+	LinkedList(LinkedList<ItemType, Allocator>&& aList);
+	~LinkedList();
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool insert(int newPosition, ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(int newPosition, Args&&... args); // builds the new entry in place
+	template<class InputIterator>
+	bool insertRange(int newPosition, InputIterator first, InputIterator last); // [first, last) starts at newPosition
+	bool remove(int position);
+	void clear();
+	ItemType getEntry(int position) const;
+	void setEntry(int position, const ItemType& newEntry);
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	Cursor getCursorAt(int position); // at the item at position; position 0 is before the first item
+	const LinkedList<ItemType, Allocator>& operator=(LinkedList<ItemType, Allocator>&& aList);
+};
+
+template<class ItemType>
+class ArrayList : public ListInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 100;
+	ItemType* items; // uninitialized past itemCount
+	int itemCount;
+	int maxItems;
+public:
+	typedef ItemType* iterator;
+	typedef const ItemType* const_iterator;
+
+	ArrayList();
+	template<class InputIterator>
+	ArrayList(InputIterator first, InputIterator last);
+	ArrayList(const ArrayList& aList);
+	ArrayList(ArrayList&& aList);
+	~ArrayList();
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool insert(int newPosition, ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(int newPosition, Args&&... args);
+	template<class InputIterator>
+	bool insertRange(int newPosition, InputIterator first, InputIterator last); // [first, last) starts at newPosition
+	bool remove(int position);
+	void clear();
+	ItemType getEntry(int position) const;
+	void setEntry(int position, const ItemType& newEntry);
+	void reserve(int newCapacity); // makes room for newCapacity items (never shrinks)
+	void shrink_to_fit();          // gives back the capacity past getLength()
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const ArrayList<ItemType>& operator=(ArrayList<ItemType>&& aList);
+};
+
+// Linked list of chunks that hold up to ChunkSize items each in a small array, so a walk to a
+// position skips a whole chunk per hop (from whichever end is nearer) and the items of a chunk
+// share cache lines. A full chunk is split in two on insert; a chunk that drops below half full
+// on remove takes items from its next chunk, or is merged with it when both fit in one.
+// Chunks that are given up are kept for reuse (shrink_to_fit() releases them).
+template<class ItemType, int ChunkSize = 32>
+class UnrolledList : public ListInterface<ItemType>
+{
+private:
+	struct Chunk
+	{
+		Chunk* prev;
+		Chunk* next;
+		int count; // items[0 .. count - 1] are constructed
+		alignas(ItemType) unsigned char storage[ChunkSize * sizeof(ItemType)];
+		ItemType* items() { return reinterpret_cast<ItemType*>(storage); }
+	};
+
+	Chunk* headPtr;
+	Chunk* tailPtr;
+	Chunk* spareChunks; // released chunks, linked through next
+	int itemCount;
+	int chunkCount;
+
+	Chunk* getChunkAt(int position, int& index) const; // the chunk holding position, and its index there
+	Chunk* newChunkAfter(Chunk* prevChunkPtr);          // links an empty chunk after prevChunkPtr (nullptr: at the head)
+	void releaseChunk(Chunk* chunkPtr);                 // unlinks an empty chunk
+	Chunk* splitChunk(Chunk* chunkPtr, int index);      // moves items[index ..] to a new chunk after it
+	void rebalance(Chunk* chunkPtr);                    // after a remove from chunkPtr
+public:
+	// Forward iterator: an index in a chunk, moving to the next chunk past its last item
+	template<class ValueType>
+	class ChunkIterator
+	{
+	private:
+		Chunk* chunkPtr; // nullptr is end()
+		int index;
+		template<class> friend class ChunkIterator;
+	public:
+		typedef forward_iterator_tag iterator_category;
+		typedef ItemType value_type;
+		typedef ptrdiff_t difference_type;
+		typedef ValueType* pointer;
+		typedef ValueType& reference;
+
+		ChunkIterator() : chunkPtr(nullptr), index(0) {}
+		ChunkIterator(Chunk* aChunkPtr, int anIndex) : chunkPtr(aChunkPtr), index(anIndex) {}
+		template<class OtherValueType> // iterator to const_iterator
+		ChunkIterator(const ChunkIterator<OtherValueType>& anIterator) : chunkPtr(anIterator.chunkPtr), index(anIterator.index) {}
+		reference operator*() const { return chunkPtr->items()[index]; }
+		pointer operator->() const { return chunkPtr->items() + index; }
+		ChunkIterator<ValueType>& operator++()
+		{
+			if(++index == chunkPtr->count)
+			{
+				chunkPtr = chunkPtr->next;
+				index = 0;
+			}
+			return *this;
+		}
+		ChunkIterator<ValueType> operator++(int) { ChunkIterator<ValueType> oldIterator(*this); ++(*this); return oldIterator; }
+		template<class OtherValueType>
+		bool operator==(const ChunkIterator<OtherValueType>& anIterator) const { return (chunkPtr == anIterator.chunkPtr) && (index == anIterator.index); }
+		template<class OtherValueType>
+		bool operator!=(const ChunkIterator<OtherValueType>& anIterator) const { return !(*this == anIterator); }
+	};
+	typedef ChunkIterator<ItemType> iterator;
+	typedef ChunkIterator<const ItemType> const_iterator;
+
+	UnrolledList();
+	template<class InputIterator>
+	UnrolledList(InputIterator first, InputIterator last);
+	UnrolledList(const UnrolledList<ItemType, ChunkSize>& aList);
+	UnrolledList(UnrolledList<ItemType, ChunkSize>&& aList);
+	~UnrolledList();
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool insert(int newPosition, ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(int newPosition, Args&&... args);
+	template<class InputIterator>
+	bool insertRange(int newPosition, InputIterator first, InputIterator last); // [first, last) starts at newPosition
+	bool remove(int position);
+	void clear(); // keeps the chunks for reuse
+	ItemType getEntry(int position) const;
+	void setEntry(int position, const ItemType& newEntry);
+	void shrink_to_fit(); // gives back the chunks kept for reuse
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const UnrolledList<ItemType, ChunkSize>& operator=(UnrolledList<ItemType, ChunkSize>&& aList);
+};
+
+// List kept as an implicit treap: a binary tree in list order (left subtree, node, right subtree)
+// where every node knows the size of its subtree, so a position is found by one walk down, and
+// random priorities kept in heap order make the tree O(log N) deep in expectation.
+// insert, remove, getEntry and setEntry are O(log N) at any position, and so are split() and
+// concat(), which cut a list in two and join two lists.
+template<class ItemType>
+class TreapList : public ListInterface<ItemType>
+{
+private:
+	TreapNode<ItemType>* rootPtr;
+	unsigned randomState; // xorshift state for the priorities; never 0
+
+	void seedPriorities();
+	unsigned nextPriority();
+	static int sizeOf(TreapNode<ItemType>* subTreePtr);
+	static void updateNode(TreapNode<ItemType>* subTreePtr); // its size and its children's parentPtr
+	static TreapNode<ItemType>* asRoot(TreapNode<ItemType>* subTreePtr);
+	// the first count items of subTreePtr go to leftTreePtr, the others to rightTreePtr
+	static void splitTree(TreapNode<ItemType>* subTreePtr, int count, TreapNode<ItemType>*& leftTreePtr, TreapNode<ItemType>*& rightTreePtr);
+	static TreapNode<ItemType>* joinTrees(TreapNode<ItemType>* leftTreePtr, TreapNode<ItemType>* rightTreePtr); // all of left, then all of right
+	static TreapNode<ItemType>* insertNode(TreapNode<ItemType>* subTreePtr, int index, TreapNode<ItemType>* newNodePtr); // index is 0-based
+	static TreapNode<ItemType>* removeNode(TreapNode<ItemType>* subTreePtr, int index);
+	template<class InputIterator>
+	TreapNode<ItemType>* buildTree(InputIterator first, InputIterator last); // O(k), items in order
+	static int setSizes(TreapNode<ItemType>* subTreePtr);
+	static TreapNode<ItemType>* copyTree(const TreapNode<ItemType>* subTreePtr);
+	static void destroyTree(TreapNode<ItemType>* subTreePtr);
+	TreapNode<ItemType>* getNodeAt(int position) const;
+public:
+	// Forward iterator: in-order successor through the parent pointers, O(1) amortized per step
+	template<class ValueType>
+	class TreeIterator
+	{
+	private:
+		TreapNode<ItemType>* curPtr; // nullptr is end()
+		template<class> friend class TreeIterator;
+	public:
+		typedef forward_iterator_tag iterator_category;
+		typedef ItemType value_type;
+		typedef ptrdiff_t difference_type;
+		typedef ValueType* pointer;
+		typedef ValueType& reference;
+
+		TreeIterator() : curPtr(nullptr) {}
+		explicit TreeIterator(TreapNode<ItemType>* nodePtr) : curPtr(nodePtr) {}
+		template<class OtherValueType> // iterator to const_iterator
+		TreeIterator(const TreeIterator<OtherValueType>& anIterator) : curPtr(anIterator.curPtr) {}
+		reference operator*() const { return curPtr->item; }
+		pointer operator->() const { return &curPtr->item; }
+		TreeIterator<ValueType>& operator++()
+		{
+			if(curPtr->rightChildPtr != nullptr) // the leftmost node of the right subtree
+			{
+				curPtr = curPtr->rightChildPtr;
+				while(curPtr->leftChildPtr != nullptr)
+					curPtr = curPtr->leftChildPtr;
+			}
+			else // the first ancestor we are left of
+			{
+				while(curPtr->parentPtr != nullptr && curPtr->parentPtr->rightChildPtr == curPtr)
+					curPtr = curPtr->parentPtr;
+				curPtr = curPtr->parentPtr;
+			}
+			return *this;
+		}
+		TreeIterator<ValueType> operator++(int) { TreeIterator<ValueType> oldIterator(*this); ++(*this); return oldIterator; }
+		template<class OtherValueType>
+		bool operator==(const TreeIterator<OtherValueType>& anIterator) const { return (curPtr == anIterator.curPtr); }
+		template<class OtherValueType>
+		bool operator!=(const TreeIterator<OtherValueType>& anIterator) const { return (curPtr != anIterator.curPtr); }
+	};
+	typedef TreeIterator<ItemType> iterator;
+	typedef TreeIterator<const ItemType> const_iterator;
+
+	TreapList();
+	template<class InputIterator>
+	TreapList(InputIterator first, InputIterator last);
+	TreapList(const TreapList<ItemType>& aList);
+	TreapList(TreapList<ItemType>&& aList);
+	~TreapList();
+	bool isEmpty() const;
+	int getLength() const;
+	bool insert(int newPosition, const ItemType& newEntry);
+	bool insert(int newPosition, ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(int newPosition, Args&&... args);
+	template<class InputIterator>
+	bool insertRange(int newPosition, InputIterator first, InputIterator last); // [first, last) starts at newPosition
+	bool remove(int position);
+	void clear();
+	ItemType getEntry(int position) const;
+	void setEntry(int position, const ItemType& newEntry);
+	TreapList<ItemType> split(int position); // the items from position on move to the returned list
+	void concat(TreapList<ItemType>&& aList); // moves every item of aList to the end of this list
+	iterator begin(); // O(log N)
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const TreapList<ItemType>& operator=(TreapList<ItemType>&& aList);
+};
+
+//=================================================================================================
+// LinkedList
+//=================================================================================================
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList() : headPtr(nullptr), itemCount(0)
+{
+}
+
+template<class ItemType, class Allocator>
+template<class InputIterator>
+LinkedList<ItemType, Allocator>::LinkedList(InputIterator first, InputIterator last) : headPtr(nullptr), itemCount(0)
+{
+	insertRange(1, first, last);
+}
+
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList(const LinkedList<ItemType, Allocator>& aList)
+{
+	itemCount = aList.itemCount;
+	Node<ItemType>* origChainPtr = aList.headPtr; // Points to nodes in original chain
+
+	if (origChainPtr == nullptr)
+		headPtr = nullptr;  // Original bag is empty; so is copy
+	else
+	{
+		// Copy first node
+		headPtr = nodeAlloc.allocate(origChainPtr->item);
+
+		// Copy remaining nodes
+		Node<ItemType>* newChainPtr = headPtr;
+		origChainPtr = origChainPtr->next;
+		while (origChainPtr != nullptr)
+		{
+			newChainPtr->next = nodeAlloc.allocate(origChainPtr->item);
+			newChainPtr = newChainPtr->next;
+			origChainPtr = origChainPtr->next;
+		}
+
+		newChainPtr->next = nullptr; // Flag end of new chain
+	}
+}
+
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList(LinkedList<ItemType, Allocator>&& aList)
+	: headPtr(aList.headPtr), itemCount(aList.itemCount), nodeAlloc(move(aList.nodeAlloc))
+{
+	aList.headPtr = nullptr;
+	aList.itemCount = 0;
+}
+
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::~LinkedList()
+{
+	clear();
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, class Allocator>
+int LinkedList<ItemType, Allocator>::getLength() const
+{
+	return itemCount;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::insert(int newPosition, const ItemType& newEntry)
+{
+	return emplace(newPosition, newEntry);
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::insert(int newPosition, ItemType&& newEntry)
+{
+	return emplace(newPosition, move(newEntry));
+}
+
+template<class ItemType, class Allocator>
+template<class... Args>
+bool LinkedList<ItemType, Allocator>::emplace(int newPosition, Args&&... args)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
+	if(ableToInsert)
+	{	//create a new node
+		Node<ItemType>* newNodePtr = nodeAlloc.emplace(nullptr, forward<Args>(args)...);
+		// attach new node to chain
+		if(newPosition == 1)
+		{
+			newNodePtr->next = headPtr;
+			headPtr = newNodePtr;
+		}
+		else
+		{
+			Node<ItemType>* prevNodePtr = getNodeAt(newPosition - 1);
+			newNodePtr->next = prevNodePtr->next;
+			prevNodePtr->next = newNodePtr;
+		}
+		itemCount++;
+	}
+	return ableToInsert;
+}
+
+template<class ItemType, class Allocator>
+template<class InputIterator>
+bool LinkedList<ItemType, Allocator>::insertRange(int newPosition, InputIterator first, InputIterator last)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
+	if(ableToInsert)
+	{
+		// walk to the insertion point once; each new node goes after the previous one
+		Node<ItemType>* prevNodePtr = (newPosition == 1) ? nullptr : getNodeAt(newPosition - 1);
+		for(; first != last; ++first)
+		{
+			if(prevNodePtr == nullptr)
+			{
+				headPtr = nodeAlloc.emplace(headPtr, *first);
+				prevNodePtr = headPtr;
+			}
+			else
+			{
+				prevNodePtr->next = nodeAlloc.emplace(prevNodePtr->next, *first);
+				prevNodePtr = prevNodePtr->next;
+			}
+			itemCount++;
+		}
+	}
+	return ableToInsert;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::remove(int position)
+{
+	bool ableToRemove = (1 <= position) && (position <= itemCount);
+	if(ableToRemove)
+	{
+		Node<ItemType>* curPtr = nullptr;
+		if(position == 1)
+		{
+			curPtr = headPtr;
+			headPtr = headPtr->next;
+		}
+		else
+		{
+			Node<ItemType>* prevNodePtr = getNodeAt(position - 1);
+			curPtr = prevNodePtr->next;
+			prevNodePtr->next = curPtr->next;
+		}
+		curPtr->next = nullptr;
+		nodeAlloc.deallocate(curPtr);
+		curPtr = nullptr;
+		itemCount--;
+	}
+	return ableToRemove;
+}
+
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::clear()
+{
+	nodeAlloc.deallocateAll(headPtr); // release the whole chain at once
+	headPtr = nullptr;
+	itemCount = 0;
+}
+
+template<class ItemType, class Allocator>
+ItemType LinkedList<ItemType, Allocator>::getEntry(int position) const
+{
+	bool ableToGet = (1 <= position) && (position <= itemCount);
+	if(ableToGet)
+	{
+		Node<ItemType>* nodePtr = getNodeAt(position);
+		return nodePtr->item;
+	}
+	else
+		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::setEntry(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (1 <= position) && (position <= itemCount);
+	if(ableToSet)
+	{
+		Node<ItemType>* nodePtr = getNodeAt(position);
+		nodePtr->item = newEntry;
+	}
+	else
+		throw logic_error("Precondition Violated Exception: setEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType, class Allocator>
+typename LinkedList<ItemType, Allocator>::iterator LinkedList<ItemType, Allocator>::begin()
+{
+	return iterator(headPtr);
+}
+
+template<class ItemType, class Allocator>
+typename LinkedList<ItemType, Allocator>::iterator LinkedList<ItemType, Allocator>::end()
+{
+	return iterator();
+}
+
+template<class ItemType, class Allocator>
+typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::begin() const
+{
+	return const_iterator(headPtr);
+}
+
+template<class ItemType, class Allocator>
+typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::end() const
+{
+	return const_iterator();
+}
+
+template<class ItemType, class Allocator>
+typename LinkedList<ItemType, Allocator>::Cursor LinkedList<ItemType, Allocator>::getCursorAt(int position)
+{
+	bool ableToGet = (0 <= position) && (position <= itemCount);
+	if(ableToGet)
+		return Cursor(this, (position == 0) ? nullptr : getNodeAt(position));
+	else
+		throw logic_error("Precondition Violated Exception: getCursorAt() called with an invalid position.\n");
+}
+
+template<class ItemType, class Allocator>
+const LinkedList<ItemType, Allocator>& LinkedList<ItemType, Allocator>::operator=(LinkedList<ItemType, Allocator>&& aList)
+{
+	if (this != &aList)
+	{
+		clear();
+		headPtr = aList.headPtr;
+		itemCount = aList.itemCount;
+		nodeAlloc = move(aList.nodeAlloc);
+		aList.headPtr = nullptr;
+		aList.itemCount = 0;
+	}
+	return *this;
+}
+
+template<class ItemType, class Allocator>
+Node<ItemType>* LinkedList<ItemType, Allocator>::getNodeAt(int position) const
+{
+	if((position < 1) && (position > itemCount))
+		throw out_of_range("out_of_range exception called at getNodeAt()\n");
+
+	Node<ItemType>* curPtr = headPtr;
+	for (int i = 1; i < position; i++)
+		curPtr = curPtr->next;
+	return curPtr;
+}
+
+//=================================================================================================
+// LinkedList::Cursor
+//=================================================================================================
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::Cursor::Cursor(LinkedList<ItemType, Allocator>* aListPtr, Node<ItemType>* nodePtr)
+	: listPtr(aListPtr), curPtr(nodePtr)
+{
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::Cursor::hasNext() const
+{
+	return (nextLink() != nullptr);
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::Cursor::advance()
+{
+	Node<ItemType>* nextNodePtr = nextLink();
+	if(nextNodePtr == nullptr)
+		return false;
+	curPtr = nextNodePtr;
+	return true;
+}
+
+template<class ItemType, class Allocator>
+ItemType& LinkedList<ItemType, Allocator>::Cursor::getEntry() const
+{
+	if(curPtr == nullptr)
+		throw logic_error("Precondition Violated Exception: getEntry() called with a cursor before the first item.\n");
+	return curPtr->item;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::Cursor::insertAfter(const ItemType& newEntry)
+{
+	return emplaceAfter(newEntry);
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::Cursor::insertAfter(ItemType&& newEntry)
+{
+	return emplaceAfter(move(newEntry));
+}
+
+template<class ItemType, class Allocator>
+template<class... Args>
+bool LinkedList<ItemType, Allocator>::Cursor::emplaceAfter(Args&&... args)
+{
+	Node<ItemType>*& link = nextLink();
+	link = listPtr->nodeAlloc.emplace(link, forward<Args>(args)...);
+	listPtr->itemCount++;
+	return true;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::Cursor::removeAfter()
+{
+	Node<ItemType>*& link = nextLink();
+	Node<ItemType>* nodeToDeletePtr = link;
+	if(nodeToDeletePtr == nullptr)
+		return false;
+
+	link = nodeToDeletePtr->next;
+	nodeToDeletePtr->next = nullptr;
+	listPtr->nodeAlloc.deallocate(nodeToDeletePtr);
+	listPtr->itemCount--;
+	return true;
+}
+
+// private member function of LinkedList::Cursor
+template<class ItemType, class Allocator>
+Node<ItemType>*& LinkedList<ItemType, Allocator>::Cursor::nextLink() const
+{
+	return (curPtr == nullptr) ? listPtr->headPtr : curPtr->next;
+}
+
+//=================================================================================================
+// ArrayList
+//=================================================================================================
+template<class ItemType>
+ArrayList<ItemType>::ArrayList() : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+}
+
+template<class ItemType>
+template<class InputIterator>
+ArrayList<ItemType>::ArrayList(InputIterator first, InputIterator last) : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+	insertRange(1, first, last);
+}
+
+template<class ItemType>
+ArrayList<ItemType>::ArrayList(const ArrayList& aList)
+{
+	itemCount = aList.itemCount;
+	maxItems = aList.maxItems;
+	items = allocateItems<ItemType>(maxItems);
+	copyItems(items, aList.items, itemCount);
+}
+
+template<class ItemType>
+ArrayList<ItemType>::ArrayList(ArrayList&& aList)
+	: items(aList.items), itemCount(aList.itemCount), maxItems(aList.maxItems)
+{
+	// aList is left empty with no capacity; its next insert() allocates again
+	aList.items = nullptr;
+	aList.itemCount = 0;
+	aList.maxItems = 0;
+}
+
+template<class ItemType>
+ArrayList<ItemType>::~ArrayList()
+{
+	destroyItems(items, 0, itemCount);
+	freeItems(items);
+}
+
+template<class ItemType>
+bool ArrayList<ItemType>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType>
+int ArrayList<ItemType>::getLength() const
+{
+	return itemCount;
+}
+
+template<class ItemType>
+bool ArrayList<ItemType>::insert(int newPosition, const ItemType& newEntry)
+{
+	return emplace(newPosition, newEntry);
+}
+
+template<class ItemType>
+bool ArrayList<ItemType>::insert(int newPosition, ItemType&& newEntry)
+{
+	return emplace(newPosition, move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool ArrayList<ItemType>::emplace(int newPosition, Args&&... args)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
+	if(ableToInsert)
+	{
+		bool hasRoomToAdd = (itemCount < maxItems);
+		if(hasRoomToAdd && newPosition == itemCount + 1) // appending: build it in its slot
+		{
+			new (&items[itemCount]) ItemType(forward<Args>(args)...);
+		}
+		else
+		{
+			ItemType newEntry(forward<Args>(args)...); // before shifting: args may refer into items
+			if(!hasRoomToAdd)
+				reserve((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+			if(newPosition == itemCount + 1)
+				new (&items[itemCount]) ItemType(move(newEntry));
+			else
+			{
+				// make room for new item by shifting; the last slot is not constructed yet
+				new (&items[itemCount]) ItemType(move(items[itemCount - 1]));
+				for(int i = itemCount - 1; i >= newPosition; i--)
+					items[i] = move(items[i - 1]);
+				// insert new item
+				items[newPosition - 1] = move(newEntry);
+			}
+		}
+		itemCount++; // increase the size of the list by one
+	}
+	return ableToInsert;
+}
+
+template<class ItemType>
+template<class InputIterator>
+bool ArrayList<ItemType>::insertRange(int newPosition, InputIterator first, InputIterator last)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
+	if(ableToInsert)
+	{
+		// append the new items in one pass, then rotate them into place
+		int oldCount = itemCount;
+		int count = rangeLength(first, last);
+		if(count > 0 && itemCount + count > maxItems)
+			reserve(grownCapacity(maxItems, itemCount + count));
+		for(; first != last; ++first)
+		{
+			if(itemCount == maxItems) // only for single-pass ranges
+				reserve(grownCapacity(maxItems, itemCount + 1));
+			new (&items[itemCount]) ItemType(*first);
+			itemCount++;
+		}
+		if(newPosition <= oldCount)
+			rotate(items + newPosition - 1, items + oldCount, items + itemCount);
+	}
+	return ableToInsert;
+}
+
+template<class ItemType>
+bool ArrayList<ItemType>::remove(int position)
+{
+	bool ableToRemove = (1 <= position) && (position <= itemCount);
+	if(ableToRemove)
+	{
+		// delete item by shifting
+		for(int i = position; i < itemCount; i++)
+			items[i - 1] = move(items[i]);
+		itemCount--; // decrease count of entries
+		destroyItems(items, itemCount, itemCount + 1);
+	}
+	return ableToRemove;
+}
+
+template<class ItemType>
+void ArrayList<ItemType>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+}
+
+template<class ItemType>
+ItemType ArrayList<ItemType>::getEntry(int position) const
+{
+	bool ableToGet = (1 <= position) && (position <= itemCount);
+	if(ableToGet)
+		return items[position - 1];
+	else
+		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType>
+void ArrayList<ItemType>::setEntry(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (1 <= position) && (position <= itemCount);
+	if(ableToSet)
+		items[position - 1] = newEntry;
+	else
+		throw logic_error("Precondition Violated Exception: setEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType>
+void ArrayList<ItemType>::reserve(int newCapacity)
+{
+	if(newCapacity > maxItems)
+	{
+		items = reallocateItems(items, itemCount, newCapacity);
+		maxItems = newCapacity;
+	}
+}
+
+template<class ItemType>
+void ArrayList<ItemType>::shrink_to_fit()
+{
+	if(itemCount < maxItems)
+	{
+		items = reallocateItems(items, itemCount, itemCount);
+		maxItems = itemCount;
+	}
+}
+
+template<class ItemType>
+typename ArrayList<ItemType>::iterator ArrayList<ItemType>::begin()
+{
+	return items;
+}
+
+template<class ItemType>
+typename ArrayList<ItemType>::iterator ArrayList<ItemType>::end()
+{
+	return items + itemCount;
+}
+
+template<class ItemType>
+typename ArrayList<ItemType>::const_iterator ArrayList<ItemType>::begin() const
+{
+	return items;
+}
+
+template<class ItemType>
+typename ArrayList<ItemType>::const_iterator ArrayList<ItemType>::end() const
+{
+	return items + itemCount;
+}
+
+template<class ItemType>
+const ArrayList<ItemType>& ArrayList<ItemType>::operator=(ArrayList<ItemType>&& aList)
+{
+	if (this != &aList)
+	{
+		destroyItems(items, 0, itemCount);
+		freeItems(items);
+		items = aList.items;
+		itemCount = aList.itemCount;
+		maxItems = aList.maxItems;
+		aList.items = nullptr;
+		aList.itemCount = 0;
+		aList.maxItems = 0;
+	}
+	return *this;
+}
+
+//=================================================================================================
+// UnrolledList
+//=================================================================================================
+template<class ItemType, int ChunkSize>
+UnrolledList<ItemType, ChunkSize>::UnrolledList()
+	: headPtr(nullptr), tailPtr(nullptr), spareChunks(nullptr), itemCount(0), chunkCount(0)
+{
+	static_assert(ChunkSize >= 2, "an UnrolledList chunk needs room for at least 2 items");
+}
+
+template<class ItemType, int ChunkSize>
+template<class InputIterator>
+UnrolledList<ItemType, ChunkSize>::UnrolledList(InputIterator first, InputIterator last)
+	: headPtr(nullptr), tailPtr(nullptr), spareChunks(nullptr), itemCount(0), chunkCount(0)
+{
+	insertRange(1, first, last);
+}
+
+template<class ItemType, int ChunkSize>
+UnrolledList<ItemType, ChunkSize>::UnrolledList(const UnrolledList<ItemType, ChunkSize>& aList)
+	: headPtr(nullptr), tailPtr(nullptr), spareChunks(nullptr), itemCount(0), chunkCount(0)
+{
+	for(Chunk* origChunkPtr = aList.headPtr; origChunkPtr != nullptr; origChunkPtr = origChunkPtr->next)
+	{
+		Chunk* newChunkPtr = newChunkAfter(tailPtr);
+		copyItems(newChunkPtr->items(), origChunkPtr->items(), origChunkPtr->count);
+		newChunkPtr->count = origChunkPtr->count;
+		itemCount += origChunkPtr->count;
+	}
+}
+
+template<class ItemType, int ChunkSize>
+UnrolledList<ItemType, ChunkSize>::UnrolledList(UnrolledList<ItemType, ChunkSize>&& aList)
+	: headPtr(aList.headPtr), tailPtr(aList.tailPtr), spareChunks(aList.spareChunks),
+	  itemCount(aList.itemCount), chunkCount(aList.chunkCount)
+{
+	aList.headPtr = nullptr;
+	aList.tailPtr = nullptr;
+	aList.spareChunks = nullptr;
+	aList.itemCount = 0;
+	aList.chunkCount = 0;
+}
+
+template<class ItemType, int ChunkSize>
+UnrolledList<ItemType, ChunkSize>::~UnrolledList()
+{
+	clear();
+	shrink_to_fit();
+}
+
+template<class ItemType, int ChunkSize>
+bool UnrolledList<ItemType, ChunkSize>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, int ChunkSize>
+int UnrolledList<ItemType, ChunkSize>::getLength() const
+{
+	return itemCount;
+}
+
+template<class ItemType, int ChunkSize>
+bool UnrolledList<ItemType, ChunkSize>::insert(int newPosition, const ItemType& newEntry)
+{
+	return emplace(newPosition, newEntry);
+}
+
+template<class ItemType, int ChunkSize>
+bool UnrolledList<ItemType, ChunkSize>::insert(int newPosition, ItemType&& newEntry)
+{
+	return emplace(newPosition, move(newEntry));
+}
+
+template<class ItemType, int ChunkSize>
+template<class... Args>
+bool UnrolledList<ItemType, ChunkSize>::emplace(int newPosition, Args&&... args)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
+	if(ableToInsert)
+	{
+		ItemType newEntry(forward<Args>(args)...); // before shifting: args may refer into the list
+		Chunk* chunkPtr;
+		int index;
+		if(newPosition == itemCount + 1) // appending: after the last item of the last chunk
+		{
+			chunkPtr = (tailPtr != nullptr) ? tailPtr : newChunkAfter(nullptr);
+			index = chunkPtr->count;
+		}
+		else
+			chunkPtr = getChunkAt(newPosition, index);
+
+		if(index == ChunkSize) // after the end of a full chunk: start a new one
+		{
+			chunkPtr = newChunkAfter(chunkPtr);
+			index = 0;
+		}
+		else if(chunkPtr->count == ChunkSize) // full: split it, and insert into the half index is in
+		{
+			Chunk* upperChunkPtr = splitChunk(chunkPtr, ChunkSize / 2);
+			if(index > ChunkSize / 2)
+			{
+				chunkPtr = upperChunkPtr;
+				index -= ChunkSize / 2;
+			}
+		}
+
+		// make room for new item by shifting; the last slot is not constructed yet
+		ItemType* items = chunkPtr->items();
+		if(index == chunkPtr->count)
+			new (&items[index]) ItemType(move(newEntry));
+		else
+		{
+			new (&items[chunkPtr->count]) ItemType(move(items[chunkPtr->count - 1]));
+			for(int i = chunkPtr->count - 1; i > index; i--)
+				items[i] = move(items[i - 1]);
+			items[index] = move(newEntry);
+		}
+		chunkPtr->count++;
+		itemCount++;
+	}
+	return ableToInsert;
+}
+
+template<class ItemType, int ChunkSize>
+template<class InputIterator>
+bool UnrolledList<ItemType, ChunkSize>::insertRange(int newPosition, InputIterator first, InputIterator last)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= itemCount + 1);
+	if(ableToInsert && first != last)
+	{
+		// split at the insertion point once, then fill chunks after it in order
+		Chunk* chunkPtr;
+		Chunk* lowerChunkPtr = nullptr; // the front part of a chunk that was split
+		if(newPosition == itemCount + 1)
+			chunkPtr = tailPtr;
+		else
+		{
+			int index;
+			chunkPtr = getChunkAt(newPosition, index);
+			if(index == 0)
+				chunkPtr = chunkPtr->prev;
+			else
+			{
+				splitChunk(chunkPtr, index);
+				lowerChunkPtr = chunkPtr;
+			}
+		}
+		for(; first != last; ++first)
+		{
+			if(chunkPtr == nullptr || chunkPtr->count == ChunkSize)
+				chunkPtr = newChunkAfter(chunkPtr);
+			new (&chunkPtr->items()[chunkPtr->count]) ItemType(*first);
+			chunkPtr->count++;
+			itemCount++;
+		}
+		// the last chunk filled, and both parts of a split chunk, may be left less than half full
+		if(lowerChunkPtr != nullptr)
+			rebalance(chunkPtr->next);
+		rebalance(chunkPtr);
+		if(lowerChunkPtr != nullptr && lowerChunkPtr != chunkPtr)
+			rebalance(lowerChunkPtr);
+	}
+	return ableToInsert;
+}
+
+template<class ItemType, int ChunkSize>
+bool UnrolledList<ItemType, ChunkSize>::remove(int position)
+{
+	bool ableToRemove = (1 <= position) && (position <= itemCount);
+	if(ableToRemove)
+	{
+		int index;
+		Chunk* chunkPtr = getChunkAt(position, index);
+		// delete item by shifting
+		ItemType* items = chunkPtr->items();
+		for(int i = index + 1; i < chunkPtr->count; i++)
+			items[i - 1] = move(items[i]);
+		chunkPtr->count--;
+		destroyItems(items, chunkPtr->count, chunkPtr->count + 1);
+		itemCount--;
+		rebalance(chunkPtr);
+	}
+	return ableToRemove;
+}
+
+template<class ItemType, int ChunkSize>
+void UnrolledList<ItemType, ChunkSize>::clear()
+{
+	while(headPtr != nullptr)
+	{
+		destroyItems(headPtr->items(), 0, headPtr->count);
+		headPtr->count = 0;
+		releaseChunk(headPtr);
+	}
+	itemCount = 0;
+}
+
+template<class ItemType, int ChunkSize>
+ItemType UnrolledList<ItemType, ChunkSize>::getEntry(int position) const
+{
+	bool ableToGet = (1 <= position) && (position <= itemCount);
+	if(ableToGet)
+	{
+		int index;
+		Chunk* chunkPtr = getChunkAt(position, index);
+		return chunkPtr->items()[index];
+	}
+	else
+		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType, int ChunkSize>
+void UnrolledList<ItemType, ChunkSize>::setEntry(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (1 <= position) && (position <= itemCount);
+	if(ableToSet)
+	{
+		int index;
+		Chunk* chunkPtr = getChunkAt(position, index);
+		chunkPtr->items()[index] = newEntry;
+	}
+	else
+		throw logic_error("Precondition Violated Exception: setEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType, int ChunkSize>
+void UnrolledList<ItemType, ChunkSize>::shrink_to_fit()
+{
+	while(spareChunks != nullptr)
+	{
+		Chunk* chunkToDeletePtr = spareChunks;
+		spareChunks = spareChunks->next;
+		delete chunkToDeletePtr;
+	}
+}
+
+// a chunk in the list is never empty, so the first item is at index 0 of headPtr
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::iterator UnrolledList<ItemType, ChunkSize>::begin()
+{
+	return iterator(headPtr, 0);
+}
+
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::iterator UnrolledList<ItemType, ChunkSize>::end()
+{
+	return iterator();
+}
+
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::const_iterator UnrolledList<ItemType, ChunkSize>::begin() const
+{
+	return const_iterator(headPtr, 0);
+}
+
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::const_iterator UnrolledList<ItemType, ChunkSize>::end() const
+{
+	return const_iterator();
+}
+
+template<class ItemType, int ChunkSize>
+const UnrolledList<ItemType, ChunkSize>& UnrolledList<ItemType, ChunkSize>::operator=(UnrolledList<ItemType, ChunkSize>&& aList)
+{
+	if (this != &aList)
+	{
+		clear();
+		shrink_to_fit();
+		headPtr = aList.headPtr;
+		tailPtr = aList.tailPtr;
+		spareChunks = aList.spareChunks;
+		itemCount = aList.itemCount;
+		chunkCount = aList.chunkCount;
+		aList.headPtr = nullptr;
+		aList.tailPtr = nullptr;
+		aList.spareChunks = nullptr;
+		aList.itemCount = 0;
+		aList.chunkCount = 0;
+	}
+	return *this;
+}
+
+// private member function of UnrolledList
+// Walks from the nearer end, one chunk per step
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::Chunk* UnrolledList<ItemType, ChunkSize>::getChunkAt(int position, int& index) const
+{
+	if((position < 1) || (position > itemCount))
+		throw out_of_range("out_of_range exception called at getChunkAt()\n");
+
+	Chunk* curPtr;
+	if(position <= itemCount / 2)
+	{
+		int firstPosition = 1; // position of curPtr->items()[0]
+		curPtr = headPtr;
+		while(position >= firstPosition + curPtr->count)
+		{
+			firstPosition += curPtr->count;
+			curPtr = curPtr->next;
+		}
+		index = position - firstPosition;
+	}
+	else
+	{
+		int lastPosition = itemCount; // position of the last item of curPtr
+		curPtr = tailPtr;
+		while(position <= lastPosition - curPtr->count)
+		{
+			lastPosition -= curPtr->count;
+			curPtr = curPtr->prev;
+		}
+		index = curPtr->count - 1 - (lastPosition - position);
+	}
+	return curPtr;
+}
+
+// private member function of UnrolledList
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::Chunk* UnrolledList<ItemType, ChunkSize>::newChunkAfter(Chunk* prevChunkPtr)
+{
+	Chunk* newChunkPtr;
+	if(spareChunks != nullptr)
+	{
+		newChunkPtr = spareChunks;
+		spareChunks = spareChunks->next;
+	}
+	else
+		newChunkPtr = new Chunk;
+	newChunkPtr->count = 0;
+	newChunkPtr->prev = prevChunkPtr;
+	newChunkPtr->next = (prevChunkPtr == nullptr) ? headPtr : prevChunkPtr->next;
+	if(newChunkPtr->next != nullptr)
+		newChunkPtr->next->prev = newChunkPtr;
+	else
+		tailPtr = newChunkPtr;
+	if(prevChunkPtr != nullptr)
+		prevChunkPtr->next = newChunkPtr;
+	else
+		headPtr = newChunkPtr;
+	chunkCount++;
+	return newChunkPtr;
+}
+
+// private member function of UnrolledList
+template<class ItemType, int ChunkSize>
+void UnrolledList<ItemType, ChunkSize>::releaseChunk(Chunk* chunkPtr)
+{
+	if(chunkPtr->prev != nullptr)
+		chunkPtr->prev->next = chunkPtr->next;
+	else
+		headPtr = chunkPtr->next;
+	if(chunkPtr->next != nullptr)
+		chunkPtr->next->prev = chunkPtr->prev;
+	else
+		tailPtr = chunkPtr->prev;
+	chunkPtr->next = spareChunks;
+	spareChunks = chunkPtr;
+	chunkCount--;
+}
+
+// private member function of UnrolledList
+template<class ItemType, int ChunkSize>
+typename UnrolledList<ItemType, ChunkSize>::Chunk* UnrolledList<ItemType, ChunkSize>::splitChunk(Chunk* chunkPtr, int index)
+{
+	Chunk* newChunkPtr = newChunkAfter(chunkPtr);
+	newChunkPtr->count = chunkPtr->count - index;
+	relocateItems(newChunkPtr->items(), chunkPtr->items() + index, newChunkPtr->count);
+	chunkPtr->count = index;
+	return newChunkPtr;
+}
+
+// private member function of UnrolledList
+// Keeps every chunk but the last at least half full: an emptied chunk is released, and one
+// below half takes items from the next chunk (all of them if they fit)
+template<class ItemType, int ChunkSize>
+void UnrolledList<ItemType, ChunkSize>::rebalance(Chunk* chunkPtr)
+{
+	if(chunkPtr->count == 0)
+	{
+		releaseChunk(chunkPtr);
+		return;
+	}
+	Chunk* nextChunkPtr = chunkPtr->next;
+	if(chunkPtr->count >= ChunkSize / 2 || nextChunkPtr == nullptr)
+		return;
+
+	if(chunkPtr->count + nextChunkPtr->count <= ChunkSize) // merge
+	{
+		relocateItems(chunkPtr->items() + chunkPtr->count, nextChunkPtr->items(), nextChunkPtr->count);
+		chunkPtr->count += nextChunkPtr->count;
+		nextChunkPtr->count = 0;
+		releaseChunk(nextChunkPtr);
+	}
+	else // borrow from the front of the next chunk until both are about even
+	{
+		int movedCount = (nextChunkPtr->count - chunkPtr->count) / 2;
+		ItemType* nextItems = nextChunkPtr->items();
+		relocateItems(chunkPtr->items() + chunkPtr->count, nextItems, movedCount);
+		chunkPtr->count += movedCount;
+		// slide the rest of the next chunk down: relocate, as the vacated front is unconstructed
+		for(int i = movedCount; i < nextChunkPtr->count; i++)
+		{
+			new (&nextItems[i - movedCount]) ItemType(move(nextItems[i]));
+			nextItems[i].~ItemType();
+		}
+		nextChunkPtr->count -= movedCount;
+	}
+}
+
+//=================================================================================================
+// TreapList
+//=================================================================================================
+template<class ItemType>
+TreapList<ItemType>::TreapList() : rootPtr(nullptr)
+{
+	seedPriorities();
+}
+
+template<class ItemType>
+template<class InputIterator>
+TreapList<ItemType>::TreapList(InputIterator first, InputIterator last) : rootPtr(nullptr)
+{
+	seedPriorities();
+	insertRange(1, first, last);
+}
+
+template<class ItemType>
+TreapList<ItemType>::TreapList(const TreapList<ItemType>& aList)
+{
+	seedPriorities();
+	rootPtr = asRoot(copyTree(aList.rootPtr));
+}
+
+template<class ItemType>
+TreapList<ItemType>::TreapList(TreapList<ItemType>&& aList) : rootPtr(aList.rootPtr), randomState(aList.randomState)
+{
+	aList.rootPtr = nullptr;
+}
+
+template<class ItemType>
+TreapList<ItemType>::~TreapList()
+{
+	clear();
+}
+
+template<class ItemType>
+bool TreapList<ItemType>::isEmpty() const
+{
+	return (rootPtr == nullptr);
+}
+
+template<class ItemType>
+int TreapList<ItemType>::getLength() const
+{
+	return sizeOf(rootPtr);
+}
+
+template<class ItemType>
+bool TreapList<ItemType>::insert(int newPosition, const ItemType& newEntry)
+{
+	return emplace(newPosition, newEntry);
+}
+
+template<class ItemType>
+bool TreapList<ItemType>::insert(int newPosition, ItemType&& newEntry)
+{
+	return emplace(newPosition, move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool TreapList<ItemType>::emplace(int newPosition, Args&&... args)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= getLength() + 1);
+	if(ableToInsert)
+	{
+		TreapNode<ItemType>* newNodePtr = new TreapNode<ItemType>(nextPriority(), forward<Args>(args)...);
+		rootPtr = asRoot(insertNode(rootPtr, newPosition - 1, newNodePtr));
+	}
+	return ableToInsert;
+}
+
+template<class ItemType>
+template<class InputIterator>
+bool TreapList<ItemType>::insertRange(int newPosition, InputIterator first, InputIterator last)
+{
+	bool ableToInsert = (1 <= newPosition) && (newPosition <= getLength() + 1);
+	if(ableToInsert)
+	{
+		// build first: a copy that throws then leaves the list as it was
+		TreapNode<ItemType>* newTreePtr = buildTree(first, last);
+		TreapNode<ItemType>* leftTreePtr;
+		TreapNode<ItemType>* rightTreePtr;
+		splitTree(rootPtr, newPosition - 1, leftTreePtr, rightTreePtr);
+		rootPtr = asRoot(joinTrees(joinTrees(leftTreePtr, newTreePtr), rightTreePtr));
+	}
+	return ableToInsert;
+}
+
+template<class ItemType>
+bool TreapList<ItemType>::remove(int position)
+{
+	bool ableToRemove = (1 <= position) && (position <= getLength());
+	if(ableToRemove)
+		rootPtr = asRoot(removeNode(rootPtr, position - 1));
+	return ableToRemove;
+}
+
+template<class ItemType>
+void TreapList<ItemType>::clear()
+{
+	destroyTree(rootPtr);
+	rootPtr = nullptr;
+}
+
+template<class ItemType>
+ItemType TreapList<ItemType>::getEntry(int position) const
+{
+	bool ableToGet = (1 <= position) && (position <= getLength());
+	if(ableToGet)
+		return getNodeAt(position)->item;
+	else
+		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType>
+void TreapList<ItemType>::setEntry(int position, const ItemType& newEntry)
+{
+	bool ableToSet = (1 <= position) && (position <= getLength());
+	if(ableToSet)
+		getNodeAt(position)->item = newEntry;
+	else
+		throw logic_error("Precondition Violated Exception: setEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType>
+TreapList<ItemType> TreapList<ItemType>::split(int position)
+{
+	if((position < 1) || (position > getLength() + 1))
+		throw logic_error("Precondition Violated Exception: split() called with an invalid position.\n");
+
+	TreapList<ItemType> backList;
+	splitTree(rootPtr, position - 1, rootPtr, backList.rootPtr);
+	asRoot(rootPtr);
+	asRoot(backList.rootPtr);
+	return backList;
+}
+
+template<class ItemType>
+void TreapList<ItemType>::concat(TreapList<ItemType>&& aList)
+{
+	if(this == &aList)
+		return;
+
+	rootPtr = asRoot(joinTrees(rootPtr, aList.rootPtr));
+	aList.rootPtr = nullptr;
+}
+
+template<class ItemType>
+typename TreapList<ItemType>::iterator TreapList<ItemType>::begin()
+{
+	TreapNode<ItemType>* curPtr = rootPtr;
+	while(curPtr != nullptr && curPtr->leftChildPtr != nullptr)
+		curPtr = curPtr->leftChildPtr;
+	return iterator(curPtr);
+}
+
+template<class ItemType>
+typename TreapList<ItemType>::iterator TreapList<ItemType>::end()
+{
+	return iterator();
+}
+
+template<class ItemType>
+typename TreapList<ItemType>::const_iterator TreapList<ItemType>::begin() const
+{
+	TreapNode<ItemType>* curPtr = rootPtr;
+	while(curPtr != nullptr && curPtr->leftChildPtr != nullptr)
+		curPtr = curPtr->leftChildPtr;
+	return const_iterator(curPtr);
+}
+
+template<class ItemType>
+typename TreapList<ItemType>::const_iterator TreapList<ItemType>::end() const
+{
+	return const_iterator();
+}
+
+template<class ItemType>
+const TreapList<ItemType>& TreapList<ItemType>::operator=(TreapList<ItemType>&& aList)
+{
+	if (this != &aList)
+	{
+		clear();
+		rootPtr = aList.rootPtr;
+		randomState = aList.randomState;
+		aList.rootPtr = nullptr;
+	}
+	return *this;
+}
+
+// private member function of TreapList
+// Seeded from the list's address, so that lists later joined by concat() draw different priorities
+template<class ItemType>
+void TreapList<ItemType>::seedPriorities()
+{
+	randomState = (2463534242u ^ static_cast<unsigned>(reinterpret_cast<size_t>(this) >> 4)) | 1;
+}
+
+// private member function of TreapList
+template<class ItemType>
+unsigned TreapList<ItemType>::nextPriority()
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState;
+}
+
+// private member function of TreapList
+template<class ItemType>
+int TreapList<ItemType>::sizeOf(TreapNode<ItemType>* subTreePtr)
+{
+	return (subTreePtr == nullptr) ? 0 : subTreePtr->size;
+}
+
+// private member function of TreapList
+// Called whenever the children of subTreePtr change
+template<class ItemType>
+void TreapList<ItemType>::updateNode(TreapNode<ItemType>* subTreePtr)
+{
+	subTreePtr->size = 1 + sizeOf(subTreePtr->leftChildPtr) + sizeOf(subTreePtr->rightChildPtr);
+	if(subTreePtr->leftChildPtr != nullptr)
+		subTreePtr->leftChildPtr->parentPtr = subTreePtr;
+	if(subTreePtr->rightChildPtr != nullptr)
+		subTreePtr->rightChildPtr->parentPtr = subTreePtr;
+}
+
+// private member function of TreapList
+// The private functions leave the parentPtr of the tree they return as it was
+template<class ItemType>
+TreapNode<ItemType>* TreapList<ItemType>::asRoot(TreapNode<ItemType>* subTreePtr)
+{
+	if(subTreePtr != nullptr)
+		subTreePtr->parentPtr = nullptr;
+	return subTreePtr;
+}
+
+// private member function of TreapList
+// Recursive: the root goes left or right of the cut, and the subtree on the cut's side is split
+template<class ItemType>
+void TreapList<ItemType>::splitTree(TreapNode<ItemType>* subTreePtr, int count,
+									TreapNode<ItemType>*& leftTreePtr, TreapNode<ItemType>*& rightTreePtr)
+{
+	if(subTreePtr == nullptr)
+	{
+		leftTreePtr = nullptr;
+		rightTreePtr = nullptr;
+	}
+	else if(sizeOf(subTreePtr->leftChildPtr) < count) // the root is among the first count
+	{
+		splitTree(subTreePtr->rightChildPtr, count - sizeOf(subTreePtr->leftChildPtr) - 1,
+				  subTreePtr->rightChildPtr, rightTreePtr);
+		updateNode(subTreePtr);
+		leftTreePtr = subTreePtr;
+	}
+	else
+	{
+		splitTree(subTreePtr->leftChildPtr, count, leftTreePtr, subTreePtr->leftChildPtr);
+		updateNode(subTreePtr);
+		rightTreePtr = subTreePtr;
+	}
+}
+
+// private member function of TreapList
+// Recursive: the root with the higher priority stays on top
+template<class ItemType>
+TreapNode<ItemType>* TreapList<ItemType>::joinTrees(TreapNode<ItemType>* leftTreePtr, TreapNode<ItemType>* rightTreePtr)
+{
+	if(leftTreePtr == nullptr)
+		return rightTreePtr;
+	if(rightTreePtr == nullptr)
+		return leftTreePtr;
+
+	if(leftTreePtr->priority >= rightTreePtr->priority)
+	{
+		leftTreePtr->rightChildPtr = joinTrees(leftTreePtr->rightChildPtr, rightTreePtr);
+		updateNode(leftTreePtr);
+		return leftTreePtr;
+	}
+	else
+	{
+		rightTreePtr->leftChildPtr = joinTrees(leftTreePtr, rightTreePtr->leftChildPtr);
+		updateNode(rightTreePtr);
+		return rightTreePtr;
+	}
+}
+
+// private member function of TreapList
+// Walks down to where newNodePtr's priority belongs, and splits the subtree found there under it
+template<class ItemType>
+TreapNode<ItemType>* TreapList<ItemType>::insertNode(TreapNode<ItemType>* subTreePtr, int index, TreapNode<ItemType>* newNodePtr)
+{
+	if(subTreePtr == nullptr)
+		return newNodePtr;
+
+	if(newNodePtr->priority > subTreePtr->priority)
+	{
+		splitTree(subTreePtr, index, newNodePtr->leftChildPtr, newNodePtr->rightChildPtr);
+		updateNode(newNodePtr);
+		return newNodePtr;
+	}
+	int leftSize = sizeOf(subTreePtr->leftChildPtr);
+	if(index <= leftSize)
+		subTreePtr->leftChildPtr = insertNode(subTreePtr->leftChildPtr, index, newNodePtr);
+	else
+		subTreePtr->rightChildPtr = insertNode(subTreePtr->rightChildPtr, index - leftSize - 1, newNodePtr);
+	updateNode(subTreePtr);
+	return subTreePtr;
+}
+
+// private member function of TreapList
+// The node found is replaced by the join of its two subtrees
+template<class ItemType>
+TreapNode<ItemType>* TreapList<ItemType>::removeNode(TreapNode<ItemType>* subTreePtr, int index)
+{
+	int leftSize = sizeOf(subTreePtr->leftChildPtr);
+	if(index == leftSize)
+	{
+		TreapNode<ItemType>* joinedTreePtr = joinTrees(subTreePtr->leftChildPtr, subTreePtr->rightChildPtr);
+		delete subTreePtr;
+		return joinedTreePtr;
+	}
+	if(index < leftSize)
+		subTreePtr->leftChildPtr = removeNode(subTreePtr->leftChildPtr, index);
+	else
+		subTreePtr->rightChildPtr = removeNode(subTreePtr->rightChildPtr, index - leftSize - 1);
+	updateNode(subTreePtr);
+	return subTreePtr;
+}
+
+// private member function of TreapList
+// Each new node goes at the end: it climbs the right spine past the nodes of lower priority,
+// which become its left subtree. The spine is kept in an array; sizes are set once at the end.
+template<class ItemType>
+template<class InputIterator>
+TreapNode<ItemType>* TreapList<ItemType>::buildTree(InputIterator first, InputIterator last)
+{
+	int spineCount = 0;
+	int maxSpine = 0;
+	TreapNode<ItemType>** spine = nullptr; // spine[0] is the root
+	try
+	{
+		for(; first != last; ++first)
+		{
+			// grow the spine before the new node is linked, so a throw leaves every node reachable
+			if(spineCount == maxSpine)
+			{
+				spine = reallocateItems(spine, spineCount, grownCapacity(maxSpine, 16));
+				maxSpine = grownCapacity(maxSpine, 16);
+			}
+			TreapNode<ItemType>* newNodePtr = new TreapNode<ItemType>(nextPriority(), *first);
+			TreapNode<ItemType>* lastPoppedPtr = nullptr;
+			while(spineCount > 0 && spine[spineCount - 1]->priority < newNodePtr->priority)
+				lastPoppedPtr = spine[--spineCount];
+			newNodePtr->leftChildPtr = lastPoppedPtr;
+			if(spineCount > 0)
+				spine[spineCount - 1]->rightChildPtr = newNodePtr;
+			spine[spineCount++] = newNodePtr;
+		}
+	}
+	catch(...)
+	{
+		if(spineCount > 0)
+			destroyTree(spine[0]);
+		freeItems(spine);
+		throw;
+	}
+
+	TreapNode<ItemType>* newRootPtr = (spineCount > 0) ? spine[0] : nullptr;
+	freeItems(spine);
+	setSizes(newRootPtr);
+	return newRootPtr;
+}
+
+// private member function of TreapList
+// Post-order, so the children's sizes are set first
+template<class ItemType>
+int TreapList<ItemType>::setSizes(TreapNode<ItemType>* subTreePtr)
+{
+	if(subTreePtr == nullptr)
+		return 0;
+	setSizes(subTreePtr->leftChildPtr);
+	setSizes(subTreePtr->rightChildPtr);
+	updateNode(subTreePtr);
+	return subTreePtr->size;
+}
+
+// private member function of TreapList
+template<class ItemType>
+TreapNode<ItemType>* TreapList<ItemType>::copyTree(const TreapNode<ItemType>* subTreePtr)
+{
+	if(subTreePtr == nullptr)
+		return nullptr;
+
+	TreapNode<ItemType>* newTreePtr = new TreapNode<ItemType>(subTreePtr->priority, subTreePtr->item);
+	newTreePtr->leftChildPtr = copyTree(subTreePtr->leftChildPtr);
+	newTreePtr->rightChildPtr = copyTree(subTreePtr->rightChildPtr);
+	updateNode(newTreePtr);
+	return newTreePtr;
+}
+
+// private member function of TreapList
+template<class ItemType>
+void TreapList<ItemType>::destroyTree(TreapNode<ItemType>* subTreePtr)
+{
+	if(subTreePtr != nullptr)
+	{
+		destroyTree(subTreePtr->leftChildPtr);
+		destroyTree(subTreePtr->rightChildPtr);
+		delete subTreePtr;
+	}
+}
+
+// private member function of TreapList
+template<class ItemType>
+TreapNode<ItemType>* TreapList<ItemType>::getNodeAt(int position) const
+{
+	if((position < 1) || (position > getLength()))
+		throw out_of_range("out_of_range exception called at getNodeAt()\n");
+
+	int index = position - 1;
+	TreapNode<ItemType>* curPtr = rootPtr;
+	while(index != sizeOf(curPtr->leftChildPtr))
+	{
+		int leftSize = sizeOf(curPtr->leftChildPtr);
+		if(index < leftSize)
+			curPtr = curPtr->leftChildPtr;
+		else
+		{
+			index -= leftSize + 1;
+			curPtr = curPtr->rightChildPtr;
+		}
+	}
+	return curPtr;
+}
+#endif // !_LIST_H_
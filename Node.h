@@ -1,29 +1,393 @@
-// Node.h
-#ifndef _NODE_H_
-#define _NODE_H_
-template<class ItemType>
-struct Node
-{
-	ItemType item;
-	Node<ItemType>* next;
-	Node();
-	Node(const ItemType& anItem);
-	Node(const ItemType& anItem, Node<ItemType>* nextNodePtr);
-};
-
-template<class ItemType>
-Node<ItemType>::Node() : next(nullptr)
-{
-}
-
-template<class ItemType>
-Node<ItemType>::Node(const ItemType& anItem) : item(anItem), next(nullptr)
-{
-}
-
-template<class ItemType>
-Node<ItemType>::Node(const ItemType& anItem, Node<ItemType>* nextNodePtr)
-	: item(anItem), next(nextNodePtr)
-{
-}
-#endif // !_NODE_H_
+// Node.h
+#ifndef _NODE_H_
+#define _NODE_H_
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<class ItemType>
+struct Node
+{
+	ItemType item;
+	Node<ItemType>* next;
+	Node();
+	Node(const ItemType& anItem);
+	Node(const ItemType& anItem, Node<ItemType>* nextNodePtr);
+	Node(ItemType&& anItem);
+	Node(ItemType&& anItem, Node<ItemType>* nextNodePtr);
+	template<class... Args>
+	Node(Node<ItemType>* nextNodePtr, Args&&... args); // builds item in place from args
+};
+
+// The default allocator of the linked containers: one new/delete per node.
+template<class ItemType>
+class NodeAllocator
+{
+public:
+	Node<ItemType>* allocate(const ItemType& anItem, Node<ItemType>* nextNodePtr = nullptr);
+	Node<ItemType>* allocate(ItemType&& anItem, Node<ItemType>* nextNodePtr = nullptr);
+	template<class... Args>
+	Node<ItemType>* emplace(Node<ItemType>* nextNodePtr, Args&&... args);
+	void deallocate(Node<ItemType>* nodePtr);
+	void deallocateAll(Node<ItemType>* headPtr); // headPtr is the container's whole chain
+};
+
+// Slab allocator: nodes are carved out of contiguous chunks of CHUNK_SIZE nodes,
+// and released nodes go onto a free list for reuse.
+// Every container owns its pool, so deallocateAll() can give all chunks back at once.
+// (no per-node work at all when ItemType is trivially destructible)
+template<class ItemType, int CHUNK_SIZE = 256>
+class NodePool
+{
+private:
+	struct FreeSlot
+	{
+		FreeSlot* next;
+	};
+	struct Chunk
+	{
+		Chunk* next;
+		alignas(Node<ItemType>) unsigned char storage[CHUNK_SIZE * sizeof(Node<ItemType>)];
+	};
+
+	Chunk* firstChunk;   // head of the chunk chain
+	Chunk* curChunk;     // chunk being carved; chunks after it are spare
+	int nextSlot;        // next uncarved slot in curChunk
+	FreeSlot* freeList;  // released nodes
+
+	void* getSlot();
+public:
+	NodePool();
+	NodePool(const NodePool<ItemType, CHUNK_SIZE>& aPool); // a copy starts with its own empty pool
+	NodePool(NodePool<ItemType, CHUNK_SIZE>&& aPool);      // a move takes the chunks (and so the nodes)
+	~NodePool();
+	Node<ItemType>* allocate(const ItemType& anItem, Node<ItemType>* nextNodePtr = nullptr);
+	Node<ItemType>* allocate(ItemType&& anItem, Node<ItemType>* nextNodePtr = nullptr);
+	template<class... Args>
+	Node<ItemType>* emplace(Node<ItemType>* nextNodePtr, Args&&... args);
+	void deallocate(Node<ItemType>* nodePtr);
+	void deallocateAll(Node<ItemType>* headPtr); // headPtr is the container's whole chain
+	const NodePool<ItemType, CHUNK_SIZE>& operator=(const NodePool<ItemType, CHUNK_SIZE>& aPool);
+	const NodePool<ItemType, CHUNK_SIZE>& operator=(NodePool<ItemType, CHUNK_SIZE>&& aPool); // our nodes must be released first
+};
+
+// Forward iterator over a chain of Nodes: begin()/end() of the linked containers.
+// ValueType is ItemType for an iterator and const ItemType for a const_iterator;
+// an iterator converts to a const_iterator, not the other way round.
+template<class ItemType, class ValueType = ItemType>
+class NodeIterator
+{
+private:
+	Node<ItemType>* curPtr; // nullptr is end()
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef typename std::remove_const<ValueType>::type value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+
+	NodeIterator();
+	explicit NodeIterator(Node<ItemType>* nodePtr);
+	template<class OtherValueType>
+	NodeIterator(const NodeIterator<ItemType, OtherValueType>& anIterator);
+	reference operator*() const;
+	pointer operator->() const;
+	NodeIterator<ItemType, ValueType>& operator++();
+	NodeIterator<ItemType, ValueType> operator++(int);
+	template<class OtherValueType>
+	bool operator==(const NodeIterator<ItemType, OtherValueType>& anIterator) const;
+	template<class OtherValueType>
+	bool operator!=(const NodeIterator<ItemType, OtherValueType>& anIterator) const;
+	Node<ItemType>* getNode() const;
+};
+
+//=================================================================================================
+// Node
+//=================================================================================================
+template<class ItemType>
+Node<ItemType>::Node() : next(nullptr)
+{
+}
+
+template<class ItemType>
+Node<ItemType>::Node(const ItemType& anItem) : item(anItem), next(nullptr)
+{
+}
+
+template<class ItemType>
+Node<ItemType>::Node(const ItemType& anItem, Node<ItemType>* nextNodePtr)
+	: item(anItem), next(nextNodePtr)
+{
+}
+
+template<class ItemType>
+Node<ItemType>::Node(ItemType&& anItem) : item(std::move(anItem)), next(nullptr)
+{
+}
+
+template<class ItemType>
+Node<ItemType>::Node(ItemType&& anItem, Node<ItemType>* nextNodePtr)
+	: item(std::move(anItem)), next(nextNodePtr)
+{
+}
+
+template<class ItemType>
+template<class... Args>
+Node<ItemType>::Node(Node<ItemType>* nextNodePtr, Args&&... args)
+	: item(std::forward<Args>(args)...), next(nextNodePtr)
+{
+}
+
+//=================================================================================================
+// NodeIterator
+//=================================================================================================
+template<class ItemType, class ValueType>
+NodeIterator<ItemType, ValueType>::NodeIterator() : curPtr(nullptr)
+{
+}
+
+template<class ItemType, class ValueType>
+NodeIterator<ItemType, ValueType>::NodeIterator(Node<ItemType>* nodePtr) : curPtr(nodePtr)
+{
+}
+
+template<class ItemType, class ValueType>
+template<class OtherValueType>
+NodeIterator<ItemType, ValueType>::NodeIterator(const NodeIterator<ItemType, OtherValueType>& anIterator)
+	: curPtr(anIterator.getNode())
+{
+	static_assert(std::is_const<ValueType>::value || !std::is_const<OtherValueType>::value,
+				  "a const_iterator does not convert to an iterator");
+}
+
+template<class ItemType, class ValueType>
+typename NodeIterator<ItemType, ValueType>::reference NodeIterator<ItemType, ValueType>::operator*() const
+{
+	return curPtr->item;
+}
+
+template<class ItemType, class ValueType>
+typename NodeIterator<ItemType, ValueType>::pointer NodeIterator<ItemType, ValueType>::operator->() const
+{
+	return &curPtr->item;
+}
+
+template<class ItemType, class ValueType>
+NodeIterator<ItemType, ValueType>& NodeIterator<ItemType, ValueType>::operator++()
+{
+	curPtr = curPtr->next;
+	return *this;
+}
+
+template<class ItemType, class ValueType>
+NodeIterator<ItemType, ValueType> NodeIterator<ItemType, ValueType>::operator++(int)
+{
+	NodeIterator<ItemType, ValueType> oldIterator(*this);
+	curPtr = curPtr->next;
+	return oldIterator;
+}
+
+template<class ItemType, class ValueType>
+template<class OtherValueType>
+bool NodeIterator<ItemType, ValueType>::operator==(const NodeIterator<ItemType, OtherValueType>& anIterator) const
+{
+	return (curPtr == anIterator.getNode());
+}
+
+template<class ItemType, class ValueType>
+template<class OtherValueType>
+bool NodeIterator<ItemType, ValueType>::operator!=(const NodeIterator<ItemType, OtherValueType>& anIterator) const
+{
+	return (curPtr != anIterator.getNode());
+}
+
+template<class ItemType, class ValueType>
+Node<ItemType>* NodeIterator<ItemType, ValueType>::getNode() const
+{
+	return curPtr;
+}
+
+//=================================================================================================
+// NodeAllocator
+//=================================================================================================
+template<class ItemType>
+Node<ItemType>* NodeAllocator<ItemType>::allocate(const ItemType& anItem, Node<ItemType>* nextNodePtr)
+{
+	return new Node<ItemType>(anItem, nextNodePtr);
+}
+
+template<class ItemType>
+Node<ItemType>* NodeAllocator<ItemType>::allocate(ItemType&& anItem, Node<ItemType>* nextNodePtr)
+{
+	return new Node<ItemType>(std::move(anItem), nextNodePtr);
+}
+
+template<class ItemType>
+template<class... Args>
+Node<ItemType>* NodeAllocator<ItemType>::emplace(Node<ItemType>* nextNodePtr, Args&&... args)
+{
+	return new Node<ItemType>(nextNodePtr, std::forward<Args>(args)...);
+}
+
+template<class ItemType>
+void NodeAllocator<ItemType>::deallocate(Node<ItemType>* nodePtr)
+{
+	delete nodePtr;
+}
+
+template<class ItemType>
+void NodeAllocator<ItemType>::deallocateAll(Node<ItemType>* headPtr)
+{
+	while (headPtr != nullptr)
+	{
+		Node<ItemType>* nodeToDeletePtr = headPtr;
+		headPtr = headPtr->next;
+		delete nodeToDeletePtr;
+	}
+}
+
+//=================================================================================================
+// NodePool
+//=================================================================================================
+template<class ItemType, int CHUNK_SIZE>
+NodePool<ItemType, CHUNK_SIZE>::NodePool()
+	: firstChunk(nullptr), curChunk(nullptr), nextSlot(CHUNK_SIZE), freeList(nullptr)
+{
+}
+
+template<class ItemType, int CHUNK_SIZE>
+NodePool<ItemType, CHUNK_SIZE>::NodePool(const NodePool<ItemType, CHUNK_SIZE>&)
+	: firstChunk(nullptr), curChunk(nullptr), nextSlot(CHUNK_SIZE), freeList(nullptr)
+{
+}
+
+template<class ItemType, int CHUNK_SIZE>
+NodePool<ItemType, CHUNK_SIZE>::NodePool(NodePool<ItemType, CHUNK_SIZE>&& aPool)
+	: firstChunk(aPool.firstChunk), curChunk(aPool.curChunk), nextSlot(aPool.nextSlot), freeList(aPool.freeList)
+{
+	aPool.firstChunk = nullptr;
+	aPool.curChunk = nullptr;
+	aPool.nextSlot = CHUNK_SIZE;
+	aPool.freeList = nullptr;
+}
+
+template<class ItemType, int CHUNK_SIZE>
+NodePool<ItemType, CHUNK_SIZE>::~NodePool()
+{
+	// The owning container has already released its nodes
+	while (firstChunk != nullptr)
+	{
+		Chunk* chunkToDeletePtr = firstChunk;
+		firstChunk = firstChunk->next;
+		delete chunkToDeletePtr;
+	}
+}
+
+template<class ItemType, int CHUNK_SIZE>
+Node<ItemType>* NodePool<ItemType, CHUNK_SIZE>::allocate(const ItemType& anItem, Node<ItemType>* nextNodePtr)
+{
+	return new (getSlot()) Node<ItemType>(anItem, nextNodePtr);
+}
+
+template<class ItemType, int CHUNK_SIZE>
+Node<ItemType>* NodePool<ItemType, CHUNK_SIZE>::allocate(ItemType&& anItem, Node<ItemType>* nextNodePtr)
+{
+	return new (getSlot()) Node<ItemType>(std::move(anItem), nextNodePtr);
+}
+
+template<class ItemType, int CHUNK_SIZE>
+template<class... Args>
+Node<ItemType>* NodePool<ItemType, CHUNK_SIZE>::emplace(Node<ItemType>* nextNodePtr, Args&&... args)
+{
+	return new (getSlot()) Node<ItemType>(nextNodePtr, std::forward<Args>(args)...);
+}
+
+template<class ItemType, int CHUNK_SIZE>
+void NodePool<ItemType, CHUNK_SIZE>::deallocate(Node<ItemType>* nodePtr)
+{
+	nodePtr->~Node<ItemType>();
+	FreeSlot* slotPtr = new (static_cast<void*>(nodePtr)) FreeSlot;
+	slotPtr->next = freeList;
+	freeList = slotPtr;
+}
+
+template<class ItemType, int CHUNK_SIZE>
+void NodePool<ItemType, CHUNK_SIZE>::deallocateAll(Node<ItemType>* headPtr)
+{
+	if (!std::is_trivially_destructible<ItemType>::value)
+	{
+		while (headPtr != nullptr)
+		{
+			Node<ItemType>* nodeToDestroyPtr = headPtr;
+			headPtr = headPtr->next;
+			nodeToDestroyPtr->~Node<ItemType>();
+		}
+	}
+
+	// Rewind: every chunk is free again, nothing goes back to the system
+	curChunk = firstChunk;
+	nextSlot = 0;
+	freeList = nullptr;
+}
+
+template<class ItemType, int CHUNK_SIZE>
+const NodePool<ItemType, CHUNK_SIZE>& NodePool<ItemType, CHUNK_SIZE>::operator=(const NodePool<ItemType, CHUNK_SIZE>&)
+{
+	return *this; // pools are never shared; keep our own chunks
+}
+
+template<class ItemType, int CHUNK_SIZE>
+const NodePool<ItemType, CHUNK_SIZE>& NodePool<ItemType, CHUNK_SIZE>::operator=(NodePool<ItemType, CHUNK_SIZE>&& aPool)
+{
+	if (this != &aPool)
+	{
+		while (firstChunk != nullptr)
+		{
+			Chunk* chunkToDeletePtr = firstChunk;
+			firstChunk = firstChunk->next;
+			delete chunkToDeletePtr;
+		}
+		firstChunk = aPool.firstChunk;
+		curChunk = aPool.curChunk;
+		nextSlot = aPool.nextSlot;
+		freeList = aPool.freeList;
+		aPool.firstChunk = nullptr;
+		aPool.curChunk = nullptr;
+		aPool.nextSlot = CHUNK_SIZE;
+		aPool.freeList = nullptr;
+	}
+	return *this;
+}
+
+// private
+template<class ItemType, int CHUNK_SIZE>
+void* NodePool<ItemType, CHUNK_SIZE>::getSlot()
+{
+	if (freeList != nullptr)
+	{
+		FreeSlot* slotPtr = freeList;
+		freeList = freeList->next;
+		return slotPtr;
+	}
+
+	if (curChunk == nullptr || nextSlot == CHUNK_SIZE) // current chunk is used up
+	{
+		Chunk* nextChunkPtr = (curChunk == nullptr) ? firstChunk : curChunk->next;
+		if (nextChunkPtr == nullptr) // no spare chunk; get a new one
+		{
+			nextChunkPtr = new Chunk;
+			nextChunkPtr->next = nullptr;
+			if (curChunk == nullptr)
+				firstChunk = nextChunkPtr;
+			else
+				curChunk->next = nextChunkPtr;
+		}
+		curChunk = nextChunkPtr;
+		nextSlot = 0;
+	}
+
+	return curChunk->storage + (nextSlot++) * sizeof(Node<ItemType>);
+}
+#endif // !_NODE_H_
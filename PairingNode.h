@@ -0,0 +1,22 @@
+// PairingNode.h
+#ifndef _PAIRING_NODE_H_
+#define _PAIRING_NODE_H_
+#include <utility>
+template<class ItemType>
+struct PairingNode
+{
+	ItemType item; // data portion
+	PairingNode<ItemType>* childPtr;   // pointer to the first child
+	PairingNode<ItemType>* siblingPtr; // pointer to the next sibling
+	PairingNode<ItemType>* prevPtr;    // pointer to the previous sibling, or the parent of a first child
+	template<class... Args>
+	PairingNode(Args&&... args); // builds item in place from args
+};
+
+template<class ItemType>
+template<class... Args>
+PairingNode<ItemType>::PairingNode(Args&&... args)
+	: item(std::forward<Args>(args)...), childPtr(nullptr), siblingPtr(nullptr), prevPtr(nullptr)
+{
+}
+#endif // !_PAIRING_NODE_H_
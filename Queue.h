@@ -1,249 +1,450 @@
-// Queue.h
-#ifndef _QUEUE_H_
-#define _QUEUE_H_
-#include <stdexcept>
-#include "Node.h"
-using namespace std;
-
-template<class ItemType>
-class QueueInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual bool enqueue(const ItemType& newEntry) = 0;
-	virtual bool dequeue() = 0;
-	virtual ItemType peekFront() const = 0;
-};
-
-template<class ItemType>
-class LinkedQueue : public QueueInterface<ItemType>
-{
-private:
-	Node<ItemType>* frontPtr;
-	Node<ItemType>* backPtr;
-public:
-	LinkedQueue();
-	LinkedQueue(const LinkedQueue<ItemType>& aQueue);
-	~LinkedQueue();
-	bool isEmpty() const;
-	bool enqueue(const ItemType& newEntry);
-	bool dequeue();
-	ItemType peekFront() const;
-};
-
-template<class ItemType>
-class ArrayQueue : public QueueInterface<ItemType>
-{
-private:
-	static const int DEFAULT_CAPACITY = 50;
-	ItemType* items;
-	int front;
-	int back;
-	int itemCount;
-	int maxItems;
-public:
-	ArrayQueue();
-	ArrayQueue(const ArrayQueue<ItemType>& aQueue);
-	~ArrayQueue();
-	bool isEmpty() const;
-	bool enqueue(const ItemType& newEntry);
-	bool dequeue();
-	ItemType peekFront() const;
-};
-
-//=================================================================================================
-// LinkedQueue
-//=================================================================================================
-template<class ItemType>
-LinkedQueue<ItemType>::LinkedQueue() : frontPtr(nullptr), backPtr(nullptr)
-{
-}
-
-template<class ItemType>
-LinkedQueue<ItemType>::LinkedQueue(const LinkedQueue<ItemType>& aQueue)
-{
-	Node<ItemType>* origChainPtr = aQueue.frontPtr;
-	if (origChainPtr == nullptr)
-	{
-		frontPtr = nullptr;
-		backPtr = nullptr;
-	}
-	else
-	{	// copy first node
-		frontPtr = new Node<ItemType>(origChainPtr->item);
-
-		// copy remaining nodes
-		backPtr = frontPtr;
-		origChainPtr = origChainPtr->next;
-		while (origChainPtr != nullptr)
-		{
-			backPtr->next = new Node<ItemType>(origChainPtr->item);
-			backPtr = backPtr->next;
-			origChainPtr = origChainPtr->next;
-		}
-
-		backPtr->next = nullptr; // Flag end of new chain
-	}
-}
-
-template<class ItemType>
-LinkedQueue<ItemType>::~LinkedQueue()
-{
-	while (!isEmpty())
-		dequeue();
-}
-
-template<class ItemType>
-bool LinkedQueue<ItemType>::isEmpty() const
-{
-	return (frontPtr == nullptr);
-}
-
-template<class ItemType>
-bool LinkedQueue<ItemType>::enqueue(const ItemType& newEntry)
-{
-	Node<ItemType>* newNodePtr = new Node<ItemType>(newEntry);
-
-	if (isEmpty()) // insertion into empty queue
-		frontPtr = newNodePtr;
-	else // insertion into nonempty queue
-		backPtr->next = newNodePtr;
-
-	backPtr = newNodePtr;
-	return true;
-}
-
-template<class ItemType>
-bool LinkedQueue<ItemType>::dequeue()
-{
-	bool result = false;
-	if (!isEmpty())
-	{
-		Node<ItemType>* nodeToDeletePtr = frontPtr;
-		if (frontPtr == backPtr) // A queue with one item
-		{
-			frontPtr = nullptr;
-			backPtr = nullptr;
-		}
-		else // A queue with multi items
-			frontPtr = frontPtr->next;
-
-		nodeToDeletePtr->next = nullptr;
-		delete nodeToDeletePtr;
-		nodeToDeletePtr = nullptr;
-
-		result = true;
-	}
-	return result;
-}
-
-template<class ItemType>
-ItemType LinkedQueue<ItemType>::peekFront() const
-{
-	if (isEmpty())
-		throw logic_error("Precondition Violated Exception: peekFront() called with an empty queue.\n");
-
-	return frontPtr->item;
-}
-
-//=================================================================================================
-// ArrayQueue
-//=================================================================================================
-template<class ItemType>
-ArrayQueue<ItemType>::ArrayQueue() : front(0), back(DEFAULT_CAPACITY - 1), itemCount(0), maxItems(DEFAULT_CAPACITY)
-{
-	items = new ItemType[maxItems];
-}
-
-template<class ItemType>
-ArrayQueue<ItemType>::ArrayQueue(const ArrayQueue<ItemType>& aQueue)
-{
-	front = aQueue.front;
-	back = aQueue.back;
-	itemCount = aQueue.itemCount;
-	maxItems = aQueue.maxItems;
-	items = new ItemType[maxItems];
-	if (itemCount != 0) // not empty queue
-	{
-		if (front > back) // seperate into two parts in array
-		{
-			for (int i = front; i < maxItems; i++) // the back part
-				items[i] = aQueue.items[i];
-			for (int i = 0; i <= back; i++) // the front part
-				items[i] = aQueue.items[i];
-		}
-		else // only one part in array
-		{
-			for (int i = front; i <= back; i++)
-				items[i] = aQueue.items[i];
-		}
-	}
-}
-
-template<class ItemType>
-ArrayQueue<ItemType>::~ArrayQueue()
-{
-	delete[] items;
-}
-
-template<class ItemType>
-bool ArrayQueue<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<class ItemType>
-bool ArrayQueue<ItemType>::enqueue(const ItemType& newEntry)
-{
-	bool hasRoomToAdd = (itemCount < maxItems);
-	if (!hasRoomToAdd)
-	{
-		ItemType* oldArray = items;
-		items = new ItemType[2 * maxItems];
-		if (front > back) // seperate into two parts in array
-		{
-			int i = 0;
-			for (int j = front; j < maxItems; i++, j++) // the back part
-				items[i] = oldArray[j];
-			for (int j = 0; j <= back; i++, j++) // the front part
-				items[i] = oldArray[j];
-			
-			front = 0;
-			back = maxItems - 1;
-		}
-		else // front = 0, back = maxItems - 1
-		{
-			for (int i = 0; i < maxItems; i++)
-				items[i] = oldArray[i];
-		}
-		maxItems *= 2;
-	}
-	back = (back + 1) % maxItems;
-	items[back] = newEntry;
-	itemCount++;
-
-	return true;
-}
-
-template<class ItemType>
-bool ArrayQueue<ItemType>::dequeue()
-{
-	bool result = false;
-	if (!isEmpty())
-	{
-		front = (front + 1) % maxItems;
-		itemCount--;
-		result = true;
-	}
-	return result;
-}
-
-template<class ItemType>
-ItemType ArrayQueue<ItemType>::peekFront() const
-{
-	if (isEmpty())
-		throw logic_error("Precondition Violated Exception: peekFront() called with an empty queue.\n");
-
-	return items[front];
-}
-#endif // !_QUEUE_H_
+// Queue.h
+#ifndef _QUEUE_H_
+#define _QUEUE_H_
+#include <stdexcept>
+#include <utility>
+#include "Node.h"
+#include "ArrayStorage.h"
+using namespace std;
+
+template<class ItemType>
+class QueueInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual bool enqueue(const ItemType& newEntry) = 0;
+	virtual bool dequeue() = 0;
+	virtual ItemType peekFront() const = 0;
+};
+
+template<class ItemType, class Allocator = NodeAllocator<ItemType> >
+class LinkedQueue : public QueueInterface<ItemType>
+{
+private:
+	Node<ItemType>* frontPtr;
+	Node<ItemType>* backPtr;
+	Allocator nodeAlloc; // source of the nodes (ex: NodePool<ItemType>)
+public:
+	LinkedQueue();
+	template<class InputIterator>
+	LinkedQueue(InputIterator first, InputIterator last); // *first is at the front
+	LinkedQueue(const LinkedQueue<ItemType, Allocator>& aQueue);
+	LinkedQueue(LinkedQueue<ItemType, Allocator>&& aQueue);
+	~LinkedQueue();
+	bool isEmpty() const;
+	bool enqueue(const ItemType& newEntry);
+	bool enqueue(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args); // builds the new back in place
+	template<class InputIterator>
+	bool enqueueMany(InputIterator first, InputIterator last); // enqueues [first, last) in order
+	bool dequeue();
+	ItemType peekFront() const;
+	const LinkedQueue<ItemType, Allocator>& operator=(LinkedQueue<ItemType, Allocator>&& aQueue);
+};
+
+template<class ItemType>
+class ArrayQueue : public QueueInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 50;
+	ItemType* items; // circular; only front .. back are constructed
+	int front;
+	int back;
+	int itemCount;
+	int maxItems;
+	void resize(int newCapacity); // moves the items to new storage, starting at index 0
+	void destroyAll();
+public:
+	ArrayQueue();
+	template<class InputIterator>
+	ArrayQueue(InputIterator first, InputIterator last); // *first is at the front
+	ArrayQueue(const ArrayQueue<ItemType>& aQueue);
+	ArrayQueue(ArrayQueue<ItemType>&& aQueue);
+	~ArrayQueue();
+	bool isEmpty() const;
+	bool enqueue(const ItemType& newEntry);
+	bool enqueue(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool enqueueMany(InputIterator first, InputIterator last); // enqueues [first, last) in order
+	bool dequeue();
+	ItemType peekFront() const;
+	void reserve(int newCapacity); // makes room for newCapacity items (never shrinks)
+	void shrink_to_fit();          // gives back the capacity past the current items
+	const ArrayQueue<ItemType>& operator=(ArrayQueue<ItemType>&& aQueue);
+};
+
+//=================================================================================================
+// LinkedQueue
+//=================================================================================================
+template<class ItemType, class Allocator>
+LinkedQueue<ItemType, Allocator>::LinkedQueue() : frontPtr(nullptr), backPtr(nullptr)
+{
+}
+
+template<class ItemType, class Allocator>
+template<class InputIterator>
+LinkedQueue<ItemType, Allocator>::LinkedQueue(InputIterator first, InputIterator last) : frontPtr(nullptr), backPtr(nullptr)
+{
+	enqueueMany(first, last);
+}
+
+template<class ItemType, class Allocator>
+LinkedQueue<ItemType, Allocator>::LinkedQueue(const LinkedQueue<ItemType, Allocator>& aQueue)
+{
+	Node<ItemType>* origChainPtr = aQueue.frontPtr;
+	if (origChainPtr == nullptr)
+	{
+		frontPtr = nullptr;
+		backPtr = nullptr;
+	}
+	else
+	{	// copy first node
+		frontPtr = nodeAlloc.allocate(origChainPtr->item);
+
+		// copy remaining nodes
+		backPtr = frontPtr;
+		origChainPtr = origChainPtr->next;
+		while (origChainPtr != nullptr)
+		{
+			backPtr->next = nodeAlloc.allocate(origChainPtr->item);
+			backPtr = backPtr->next;
+			origChainPtr = origChainPtr->next;
+		}
+
+		backPtr->next = nullptr; // Flag end of new chain
+	}
+}
+
+template<class ItemType, class Allocator>
+LinkedQueue<ItemType, Allocator>::LinkedQueue(LinkedQueue<ItemType, Allocator>&& aQueue)
+	: frontPtr(aQueue.frontPtr), backPtr(aQueue.backPtr), nodeAlloc(move(aQueue.nodeAlloc))
+{
+	aQueue.frontPtr = nullptr;
+	aQueue.backPtr = nullptr;
+}
+
+template<class ItemType, class Allocator>
+LinkedQueue<ItemType, Allocator>::~LinkedQueue()
+{
+	nodeAlloc.deallocateAll(frontPtr); // release the whole chain at once
+	frontPtr = nullptr;
+	backPtr = nullptr;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedQueue<ItemType, Allocator>::isEmpty() const
+{
+	return (frontPtr == nullptr);
+}
+
+template<class ItemType, class Allocator>
+bool LinkedQueue<ItemType, Allocator>::enqueue(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType, class Allocator>
+bool LinkedQueue<ItemType, Allocator>::enqueue(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType, class Allocator>
+template<class... Args>
+bool LinkedQueue<ItemType, Allocator>::emplace(Args&&... args)
+{
+	Node<ItemType>* newNodePtr = nodeAlloc.emplace(nullptr, forward<Args>(args)...);
+
+	if (isEmpty()) // insertion into empty queue
+		frontPtr = newNodePtr;
+	else // insertion into nonempty queue
+		backPtr->next = newNodePtr;
+
+	backPtr = newNodePtr;
+	return true;
+}
+
+template<class ItemType, class Allocator>
+template<class InputIterator>
+bool LinkedQueue<ItemType, Allocator>::enqueueMany(InputIterator first, InputIterator last)
+{
+	for (; first != last; ++first)
+	{
+		Node<ItemType>* newNodePtr = nodeAlloc.emplace(nullptr, *first);
+		if (isEmpty())
+			frontPtr = newNodePtr;
+		else
+			backPtr->next = newNodePtr;
+		backPtr = newNodePtr;
+	}
+	return true;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedQueue<ItemType, Allocator>::dequeue()
+{
+	bool result = false;
+	if (!isEmpty())
+	{
+		Node<ItemType>* nodeToDeletePtr = frontPtr;
+		if (frontPtr == backPtr) // A queue with one item
+		{
+			frontPtr = nullptr;
+			backPtr = nullptr;
+		}
+		else // A queue with multi items
+			frontPtr = frontPtr->next;
+
+		nodeToDeletePtr->next = nullptr;
+		nodeAlloc.deallocate(nodeToDeletePtr);
+		nodeToDeletePtr = nullptr;
+
+		result = true;
+	}
+	return result;
+}
+
+template<class ItemType, class Allocator>
+ItemType LinkedQueue<ItemType, Allocator>::peekFront() const
+{
+	if (isEmpty())
+		throw logic_error("Precondition Violated Exception: peekFront() called with an empty queue.\n");
+
+	return frontPtr->item;
+}
+
+template<class ItemType, class Allocator>
+const LinkedQueue<ItemType, Allocator>& LinkedQueue<ItemType, Allocator>::operator=(LinkedQueue<ItemType, Allocator>&& aQueue)
+{
+	if (this != &aQueue)
+	{
+		nodeAlloc.deallocateAll(frontPtr);
+		frontPtr = aQueue.frontPtr;
+		backPtr = aQueue.backPtr;
+		nodeAlloc = move(aQueue.nodeAlloc);
+		aQueue.frontPtr = nullptr;
+		aQueue.backPtr = nullptr;
+	}
+	return *this;
+}
+
+//=================================================================================================
+// ArrayQueue
+//=================================================================================================
+template<class ItemType>
+ArrayQueue<ItemType>::ArrayQueue() : front(0), back(DEFAULT_CAPACITY - 1), itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+}
+
+template<class ItemType>
+template<class InputIterator>
+ArrayQueue<ItemType>::ArrayQueue(InputIterator first, InputIterator last)
+	: front(0), back(DEFAULT_CAPACITY - 1), itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+	enqueueMany(first, last);
+}
+
+template<class ItemType>
+ArrayQueue<ItemType>::ArrayQueue(const ArrayQueue<ItemType>& aQueue)
+{
+	front = aQueue.front;
+	back = aQueue.back;
+	itemCount = aQueue.itemCount;
+	maxItems = aQueue.maxItems;
+	items = allocateItems<ItemType>(maxItems);
+	if (itemCount != 0) // not empty queue
+	{
+		if (front > back) // seperate into two parts in array
+		{
+			copyItems(items + front, aQueue.items + front, maxItems - front); // the back part
+			copyItems(items, aQueue.items, back + 1);                         // the front part
+		}
+		else // only one part in array
+		{
+			copyItems(items + front, aQueue.items + front, itemCount);
+		}
+	}
+}
+
+template<class ItemType>
+ArrayQueue<ItemType>::ArrayQueue(ArrayQueue<ItemType>&& aQueue)
+	: items(aQueue.items), front(aQueue.front), back(aQueue.back), itemCount(aQueue.itemCount), maxItems(aQueue.maxItems)
+{
+	// aQueue is left empty with no capacity; its next enqueue() allocates again
+	aQueue.items = nullptr;
+	aQueue.front = 0;
+	aQueue.back = -1;
+	aQueue.itemCount = 0;
+	aQueue.maxItems = 0;
+}
+
+template<class ItemType>
+ArrayQueue<ItemType>::~ArrayQueue()
+{
+	destroyAll();
+	freeItems(items);
+}
+
+template<class ItemType>
+bool ArrayQueue<ItemType>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType>
+bool ArrayQueue<ItemType>::enqueue(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType>
+bool ArrayQueue<ItemType>::enqueue(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool ArrayQueue<ItemType>::emplace(Args&&... args)
+{
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if (hasRoomToAdd)
+	{
+		new (&items[(back + 1) % maxItems]) ItemType(forward<Args>(args)...);
+	}
+	else
+	{
+		ItemType newEntry(forward<Args>(args)...); // before growing: args may refer into items
+		resize((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+		new (&items[(back + 1) % maxItems]) ItemType(move(newEntry));
+	}
+	back = (back + 1) % maxItems;
+	itemCount++;
+
+	return true;
+}
+
+template<class ItemType>
+template<class InputIterator>
+bool ArrayQueue<ItemType>::enqueueMany(InputIterator first, InputIterator last)
+{
+	int count = rangeLength(first, last);
+	if (count > 0 && itemCount + count > maxItems)
+		resize(grownCapacity(maxItems, itemCount + count));
+	for (; first != last; ++first)
+	{
+		if (itemCount == maxItems) // only for single-pass ranges
+			resize(grownCapacity(maxItems, itemCount + 1));
+		int newBack = (back + 1 == maxItems) ? 0 : back + 1;
+		new (&items[newBack]) ItemType(*first);
+		back = newBack;
+		itemCount++;
+	}
+
+	return true;
+}
+
+template<class ItemType>
+bool ArrayQueue<ItemType>::dequeue()
+{
+	bool result = false;
+	if (!isEmpty())
+	{
+		destroyItems(items, front, front + 1);
+		front = (front + 1) % maxItems;
+		itemCount--;
+		result = true;
+	}
+	return result;
+}
+
+template<class ItemType>
+ItemType ArrayQueue<ItemType>::peekFront() const
+{
+	if (isEmpty())
+		throw logic_error("Precondition Violated Exception: peekFront() called with an empty queue.\n");
+
+	return items[front];
+}
+
+template<class ItemType>
+void ArrayQueue<ItemType>::reserve(int newCapacity)
+{
+	if (newCapacity > maxItems)
+		resize(newCapacity);
+}
+
+template<class ItemType>
+void ArrayQueue<ItemType>::shrink_to_fit()
+{
+	if (itemCount < maxItems)
+		resize(itemCount);
+}
+
+template<class ItemType>
+const ArrayQueue<ItemType>& ArrayQueue<ItemType>::operator=(ArrayQueue<ItemType>&& aQueue)
+{
+	if (this != &aQueue)
+	{
+		destroyAll();
+		freeItems(items);
+		items = aQueue.items;
+		front = aQueue.front;
+		back = aQueue.back;
+		itemCount = aQueue.itemCount;
+		maxItems = aQueue.maxItems;
+		aQueue.items = nullptr;
+		aQueue.front = 0;
+		aQueue.back = -1;
+		aQueue.itemCount = 0;
+		aQueue.maxItems = 0;
+	}
+	return *this;
+}
+
+// private
+template<class ItemType>
+void ArrayQueue<ItemType>::resize(int newCapacity)
+{
+	ItemType* newItems = allocateItems<ItemType>(newCapacity);
+	if (itemCount != 0)
+	{
+		if (front > back) // seperate into two parts in array
+		{
+			relocateItems(newItems, items + front, maxItems - front);    // the back part
+			relocateItems(newItems + maxItems - front, items, back + 1);    // the front part
+		}
+		else // only one part in array
+		{
+			relocateItems(newItems, items + front, itemCount);
+		}
+	}
+	freeItems(items);
+	items = newItems;
+	front = 0;
+	back = itemCount - 1;
+	maxItems = newCapacity;
+}
+
+template<class ItemType>
+void ArrayQueue<ItemType>::destroyAll()
+{
+	if (itemCount != 0)
+	{
+		if (front > back) // seperate into two parts in array
+		{
+			destroyItems(items, front, maxItems);
+			destroyItems(items, 0, back + 1);
+		}
+		else // only one part in array
+		{
+			destroyItems(items, front, back + 1);
+		}
+	}
+}
+#endif // !_QUEUE_H_
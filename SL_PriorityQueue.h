@@ -1,82 +1,144 @@
-// SL_PriorityQueue.h
-// The SMALLER entry has the HIGHER priority in this SL_PriorityQueue
-// ex: High <====> Low
-//      1 < 3 < 5 < 7
-//	    a < f < m < s
-#ifndef _SL_PRIORITY_QUEUE_H_
-#define _SL_PRIORITY_QUEUE_H_
-#include "SortedList.h"
-
-template<class ItemType>
-class PriorityQueueInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual bool add(const ItemType& newEntry) = 0;
-	virtual bool remove() = 0;
-	virtual ItemType peek() const = 0;
-};
-
-template<class ItemType>
-class SL_PriorityQueue : public PriorityQueueInterface<ItemType>
-{
-private:
-	LinkedSortedList<ItemType>* slistPtr; // pointer to sorted list PriorityQueue
-public:
-	SL_PriorityQueue();
-	SL_PriorityQueue(const SL_PriorityQueue<ItemType>& aSL_PQ);
-	~SL_PriorityQueue();
-	bool isEmpty() const;
-	bool add(const ItemType& newEntry);
-	bool remove();
-	ItemType peek() const;
-};
-
-//=================================================================================================
-// SL_PriorityQueue
-//=================================================================================================
-template<class ItemType>
-SL_PriorityQueue<ItemType>::SL_PriorityQueue()
-{
-	slistPtr = new LinkedSortedList<ItemType>();
-}
-
-template<class ItemType>
-SL_PriorityQueue<ItemType>::SL_PriorityQueue(const SL_PriorityQueue<ItemType>& aSL_PQ)
-{
-	slistPtr = new LinkedSortedList<ItemType>(*(aSL_PQ.slistPtr));
-}
-
-template<class ItemType>
-SL_PriorityQueue<ItemType>::~SL_PriorityQueue()
-{
-	delete slistPtr;
-}
-
-template<class ItemType>
-bool SL_PriorityQueue<ItemType>::isEmpty() const
-{
-	return slistPtr->isEmpty();
-}
-
-template<class ItemType>
-bool SL_PriorityQueue<ItemType>::add(const ItemType& newEntry)
-{
-	slistPtr->insertSorted(newEntry);
-	return true;
-}
-
-template<class ItemType>
-bool SL_PriorityQueue<ItemType>::remove()
-{
-	return slistPtr->remove(1); // the smallest one
-								// the highest priority
-}
-
-template<class ItemType>
-ItemType SL_PriorityQueue<ItemType>::peek() const
-{
-	return slistPtr->getEntry(1); // the smallest one
-								  // the highest priority
-}
-#endif // !_SL_PRIORITY_QUEUE_H_
+// SL_PriorityQueue.h
+// The SMALLER entry has the HIGHER priority in this SL_PriorityQueue
+// ex: High <====> Low
+//      1 < 3 < 5 < 7
+//	    a < f < m < s
+// (SMALLER as told by Compare; SL_PriorityQueue<ItemType, greater<ItemType> > is SL_PriorityQueue2)
+#ifndef _SL_PRIORITY_QUEUE_H_
+#define _SL_PRIORITY_QUEUE_H_
+#include <functional>
+#include "SortedList.h"
+
+#ifndef _PRIORITY_QUEUE_INTERFACE_
+#define _PRIORITY_QUEUE_INTERFACE_ // shared with the other PriorityQueue headers
+template<class ItemType>
+class PriorityQueueInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual bool add(const ItemType& newEntry) = 0;
+	virtual bool remove() = 0;
+	virtual ItemType peek() const = 0;
+};
+#endif // !_PRIORITY_QUEUE_INTERFACE_
+
+template<class ItemType, class Compare = less<ItemType> >
+class SL_PriorityQueue : public PriorityQueueInterface<ItemType>
+{
+private:
+	LinkedSortedList<ItemType, NodeAllocator<ItemType>, Compare>* slistPtr; // pointer to sorted list PriorityQueue
+public:
+	SL_PriorityQueue();
+	template<class InputIterator>
+	SL_PriorityQueue(InputIterator first, InputIterator last);
+	SL_PriorityQueue(const SL_PriorityQueue<ItemType, Compare>& aSL_PQ);
+	SL_PriorityQueue(SL_PriorityQueue<ItemType, Compare>&& aSL_PQ);
+	~SL_PriorityQueue();
+	bool isEmpty() const;
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool addAll(InputIterator first, InputIterator last);
+	bool remove();
+	ItemType peek() const;
+	const SL_PriorityQueue<ItemType, Compare>& operator=(SL_PriorityQueue<ItemType, Compare>&& aSL_PQ);
+};
+
+//=================================================================================================
+// SL_PriorityQueue
+//=================================================================================================
+template<class ItemType, class Compare>
+SL_PriorityQueue<ItemType, Compare>::SL_PriorityQueue()
+{
+	slistPtr = new LinkedSortedList<ItemType, NodeAllocator<ItemType>, Compare>();
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+SL_PriorityQueue<ItemType, Compare>::SL_PriorityQueue(InputIterator first, InputIterator last)
+{
+	slistPtr = new LinkedSortedList<ItemType, NodeAllocator<ItemType>, Compare>(first, last);
+}
+
+template<class ItemType, class Compare>
+SL_PriorityQueue<ItemType, Compare>::SL_PriorityQueue(const SL_PriorityQueue<ItemType, Compare>& aSL_PQ)
+{
+	slistPtr = new LinkedSortedList<ItemType, NodeAllocator<ItemType>, Compare>(*(aSL_PQ.slistPtr));
+}
+
+template<class ItemType, class Compare>
+SL_PriorityQueue<ItemType, Compare>::SL_PriorityQueue(SL_PriorityQueue<ItemType, Compare>&& aSL_PQ)
+{
+	slistPtr = aSL_PQ.slistPtr;
+	aSL_PQ.slistPtr = new LinkedSortedList<ItemType, NodeAllocator<ItemType>, Compare>(); // aSL_PQ stays a usable empty queue
+}
+
+template<class ItemType, class Compare>
+SL_PriorityQueue<ItemType, Compare>::~SL_PriorityQueue()
+{
+	delete slistPtr;
+}
+
+template<class ItemType, class Compare>
+bool SL_PriorityQueue<ItemType, Compare>::isEmpty() const
+{
+	return slistPtr->isEmpty();
+}
+
+template<class ItemType, class Compare>
+bool SL_PriorityQueue<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	slistPtr->insertSorted(newEntry);
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool SL_PriorityQueue<ItemType, Compare>::add(ItemType&& newEntry)
+{
+	slistPtr->insertSorted(move(newEntry));
+	return true;
+}
+
+template<class ItemType, class Compare>
+template<class... Args>
+bool SL_PriorityQueue<ItemType, Compare>::emplace(Args&&... args)
+{
+	slistPtr->emplaceSorted(forward<Args>(args)...);
+	return true;
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+bool SL_PriorityQueue<ItemType, Compare>::addAll(InputIterator first, InputIterator last)
+{
+	slistPtr->insertSorted(first, last);
+	return true;
+}
+
+template<class ItemType, class Compare>
+bool SL_PriorityQueue<ItemType, Compare>::remove()
+{
+	return slistPtr->remove(1); // the smallest one
+								// the highest priority
+}
+
+template<class ItemType, class Compare>
+ItemType SL_PriorityQueue<ItemType, Compare>::peek() const
+{
+	return slistPtr->getEntry(1); // the smallest one
+								  // the highest priority
+}
+
+template<class ItemType, class Compare>
+const SL_PriorityQueue<ItemType, Compare>& SL_PriorityQueue<ItemType, Compare>::operator=(SL_PriorityQueue<ItemType, Compare>&& aSL_PQ)
+{
+	if (this != &aSL_PQ)
+	{
+		swap(slistPtr, aSL_PQ.slistPtr);
+		aSL_PQ.slistPtr->clear(); // aSL_PQ keeps our old list, emptied
+	}
+	return *this;
+}
+#endif // !_SL_PRIORITY_QUEUE_H_
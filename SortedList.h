@@ -1,404 +1,813 @@
-// SortedList.h
-// This SortedList is listed from SMALL to BIG
-// ex: 1 < 3 < 5 < 7
-//	   a < f < m < s
-#ifndef _SORTED_LIST_H_
-#define _SORTED_LIST_H_
-#include <stdexcept>
-#include "Node.h"
-using namespace std;
-
-template<class ItemType>
-class SortedListInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual int getLength() const = 0;
-	virtual bool remove(int position) = 0;
-	virtual void clear() = 0;
-	virtual ItemType getEntry(int position) const = 0;
-	virtual void insertSorted(const ItemType& newEntry) = 0;
-	virtual bool removeSorted(const ItemType& anEntry) = 0;
-	virtual int getPosition(const ItemType& anEntry) const = 0;
-};
-
-template<class ItemType>
-class LinkedSortedList : public SortedListInterface<ItemType>
-{
-private:
-	Node<ItemType>* headPtr;
-	int itemCount;
-
-	Node<ItemType>* getNodeAt(int position) const;
-	Node<ItemType>* getNodeBefore(const ItemType& anEntry) const;
-public:
-	LinkedSortedList();
-	LinkedSortedList(const LinkedSortedList<ItemType>& aSList);
-	~LinkedSortedList();
-	bool isEmpty() const;
-	int getLength() const;
-	bool remove(int position);
-	void clear();
-	ItemType getEntry(int position) const;
-	void insertSorted(const ItemType& newEntry);
-	bool removeSorted(const ItemType& anEntry);
-	int getPosition(const ItemType& anEntry) const;
-};
-
-template<class ItemType>
-class ArraySortedList : public SortedListInterface<ItemType>
-{
-private:
-	static const int DEFAULT_CAPACITY = 100;
-	ItemType* items;
-	int itemCount;
-	int maxItems;
-public:
-	ArraySortedList();
-	ArraySortedList(const ArraySortedList& aSList);
-	~ArraySortedList();
-	bool isEmpty() const;
-	int getLength() const;
-	bool remove(int position);
-	void clear();
-	ItemType getEntry(int position) const;
-	void insertSorted(const ItemType& newEntry);
-	bool removeSorted(const ItemType& anEntry);
-	int getPosition(const ItemType& anEntry) const;
-};
-
-//=================================================================================================
-// LinkedSortedList
-//=================================================================================================
-template<class ItemType>
-LinkedSortedList<ItemType>::LinkedSortedList() : headPtr(nullptr), itemCount(0)
-{
-}
-
-template<class ItemType>
-LinkedSortedList<ItemType>::LinkedSortedList(const LinkedSortedList<ItemType>& aSList)
-{
-	itemCount = aSList.itemCount;
-	Node<ItemType>* origChainPtr = aSList.headPtr; // Points to nodes in original chain
-
-	if (origChainPtr == nullptr)
-		headPtr = nullptr;  // Original SList is empty; so is copy
-	else
-	{
-		// Copy first node
-		headPtr = new Node<ItemType>(origChainPtr->item);
-
-		// Copy remaining nodes
-		Node<ItemType>* newChainPtr = headPtr;
-		origChainPtr = origChainPtr->next;
-		while (origChainPtr != nullptr)
-		{
-			newChainPtr->next = new Node<ItemType>(origChainPtr->item);
-			newChainPtr = newChainPtr->next;
-			origChainPtr = origChainPtr->next;
-		}
-
-		newChainPtr->next = nullptr; // Flag end of new chain
-	}
-}
-
-template<class ItemType>
-LinkedSortedList<ItemType>::~LinkedSortedList()
-{
-	clear();
-}
-
-template<class ItemType>
-bool LinkedSortedList<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<class ItemType>
-int LinkedSortedList<ItemType>::getLength() const
-{
-	return itemCount;
-}
-
-template<class ItemType>
-bool LinkedSortedList<ItemType>::remove(int position)
-{
-	bool ableToRemove = (1 <= position) && (position <= itemCount);
-	if(ableToRemove)
-	{
-		Node<ItemType>* curPtr = nullptr;
-		if(position == 1)
-		{
-			curPtr = headPtr;
-			headPtr = headPtr->next;
-		}
-		else
-		{
-			Node<ItemType>* prevNodePtr = getNodeAt(position - 1);
-			curPtr = prevNodePtr->next;
-			prevNodePtr->next = curPtr->next;
-		}
-		curPtr->next = nullptr;
-		delete curPtr;
-		curPtr = nullptr;
-		itemCount--;
-	}
-	return ableToRemove;
-}
-
-template<class ItemType>
-void LinkedSortedList<ItemType>::clear()
-{
-	while(!isEmpty())
-		remove(1);
-}
-
-template<class ItemType>
-ItemType LinkedSortedList<ItemType>::getEntry(int position) const
-{
-	bool ableToGet = (1 <= position) && (position <= itemCount);
-	if(ableToGet)
-	{
-		Node<ItemType>* nodePtr = getNodeAt(position);
-		return nodePtr->item;
-	}
-	else
-		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
-}
-
-template<class ItemType>
-void LinkedSortedList<ItemType>::insertSorted(const ItemType& newEntry)
-{
-	Node<ItemType>* newNodePtr = new Node<ItemType>(newEntry);
-	Node<ItemType>* prevPtr = getNodeBefore(newEntry);
-
-	if(isEmpty() || (prevPtr == nullptr))
-	{
-		newNodePtr->next = headPtr;
-		headPtr = newNodePtr;
-	}
-	else
-	{
-		Node<ItemType>* aftPtr = prevPtr->next;
-		newNodePtr->next = aftPtr;
-		prevPtr->next = newNodePtr;
-	}
-
-	itemCount++;
-}
-
-template<class ItemType>
-bool LinkedSortedList<ItemType>::removeSorted(const ItemType& anEntry)
-{
-	if(headPtr == nullptr) // empty sorted list
-		return false;
-	else if(headPtr->item == anEntry) // bingo at first one
-	{
-		Node<ItemType>* targetPtr = headPtr;
-		headPtr = headPtr->next;
-
-		targetPtr->next = nullptr;
-		delete targetPtr;
-		targetPtr = nullptr;
-
-		itemCount--;
-		return true;
-	}
-	else
-	{
-		Node<ItemType>* prevPtr = getNodeBefore(anEntry);
-		Node<ItemType>* targetPtr = prevPtr->next;
-		bool ableToRemoveSorted = (targetPtr != nullptr) &&
-								  (targetPtr->item == anEntry);
-		if(ableToRemoveSorted)
-		{
-			prevPtr->next = targetPtr->next;
-
-			targetPtr->next = nullptr;
-			delete targetPtr;
-			targetPtr = nullptr;
-
-			itemCount--;
-		}
-		return ableToRemoveSorted;
-	}
-}
-
-template<class ItemType>
-int LinkedSortedList<ItemType>::getPosition(const ItemType& anEntry) const
-{
-	Node<ItemType>* curPtr = headPtr;
-	int positionCnt = 1;
-
-	while((curPtr != nullptr) && (anEntry > curPtr->item))
-	{
-		curPtr = curPtr->next;
-		positionCnt++;
-	}
-	if(curPtr == nullptr) // empty list or traverse to the end
-		return -positionCnt;
-	else if (anEntry < curPtr->item) // not bingo
-		return -positionCnt;
-	else  // anEntry == curPtr->item // bingo
-		return positionCnt;
-}
-
-template<class ItemType>
-Node<ItemType>* LinkedSortedList<ItemType>::getNodeAt(int position) const
-{
-	if((position < 1) || (position > itemCount))
-		throw out_of_range("out_of_range exception called at getNodeAt()\n");
-
-	Node<ItemType>* curPtr = headPtr;
-	for (int i = 1; i < position; i++)
-		curPtr = curPtr->next;
-	return curPtr;
-}
-
-template<class ItemType>
-Node<ItemType>* LinkedSortedList<ItemType>::getNodeBefore(const ItemType& anEntry) const
-{
-	Node<ItemType>* curPtr = headPtr;
-	Node<ItemType>* prevPtr = nullptr;
-
-	while((curPtr != nullptr) && (anEntry > curPtr->item))
-	{
-		prevPtr = curPtr;
-		curPtr = curPtr->next;
-	}
-
-	return prevPtr;
-}
-
-//=================================================================================================
-// ArraySortedList
-//=================================================================================================
-template<class ItemType>
-ArraySortedList<ItemType>::ArraySortedList() : itemCount(0), maxItems(DEFAULT_CAPACITY)
-{
-	items = new ItemType[maxItems];
-}
-
-template<class ItemType>
-ArraySortedList<ItemType>::ArraySortedList(const ArraySortedList& aSList)
-{
-	itemCount = aSList.itemCount;
-	maxItems = aSList.maxItems;
-	items = new ItemType[maxItems];
-	for (int i = 0; i < itemCount; i++) {
-		items[i] = aSList.items[i];
-	}
-}
-
-template<class ItemType>
-ArraySortedList<ItemType>::~ArraySortedList()
-{
-	delete[] items;
-}
-
-template<class ItemType>
-bool ArraySortedList<ItemType>::isEmpty() const
-{
-	return (itemCount == 0);
-}
-
-template<class ItemType>
-int ArraySortedList<ItemType>::getLength() const
-{
-	return itemCount;
-}
-
-template<class ItemType>
-bool ArraySortedList<ItemType>::remove(int position)
-{
-	bool ableToRemove = (1 <= position) && (position <= itemCount);
-	if(ableToRemove)
-	{
-		// delete item by shifting
-		for(int i = position; i < itemCount; i++)
-			items[i - 1] = items[i];
-		itemCount--; // decrease count of entries
-	}
-	return ableToRemove;
-}
-
-template<class ItemType>
-void ArraySortedList<ItemType>::clear()
-{
-	itemCount = 0;
-}
-
-template<class ItemType>
-ItemType ArraySortedList<ItemType>::getEntry(int position) const
-{
-	bool ableToGet = (1 <= position) && (position <= itemCount);
-	if(ableToGet)
-		return items[position - 1];
-	else
-		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
-}
-
-template<class ItemType>
-void ArraySortedList<ItemType>::insertSorted(const ItemType& newEntry)
-{
-	bool hasRoomToAdd = (itemCount < maxItems);
-	if(!hasRoomToAdd)
-	{
-		ItemType* oldArray = items;
-		items = new ItemType[2 * maxItems];
-		for(int i = 0; i < maxItems; i++)
-			items[i] = oldArray[i];
-		delete[] oldArray;
-		maxItems *= 2;
-	}
-	int newPosition = 1;
-	for (int i = 0; i < itemCount; i++)
-	{
-		if(newEntry <= items[i])
-			break;
-		newPosition++;
-	}
-	// make room for new item by shifting
-	for(int i = itemCount; i >= newPosition; i--)
-		items[i] = items[i - 1];
-	// insert new item
-	items[newPosition - 1] = newEntry;
-	itemCount++; // increase the size of the list by one
-}
-
-template<class ItemType>
-bool ArraySortedList<ItemType>::removeSorted(const ItemType& anEntry)
-{
-	int position = 1;
-	for(int i = 0; i < itemCount; i++)
-	{
-		if(anEntry == items[i])
-		{
-			position = i + 1;
-			break;
-		}
-		else if(anEntry < items[i])
-			return false;
-	}
-	// delete item by shifting
-	for(int i = position; i < itemCount; i++)
-		items[i - 1] = items[i];
-	itemCount--; // decrease count of entries
-	return true;
-}
-
-template<class ItemType>
-int ArraySortedList<ItemType>::getPosition(const ItemType& anEntry) const
-{
-	for(int i = 0; i < itemCount; i++)
-	{
-		if(anEntry == items[i])
-		{
-			return i + 1;
-		}
-		else if(anEntry < items[i])
-			return -(i + 1);
-	}
-	return -(itemCount + 1);
-}
-#endif // !_SORTED_LIST_H_
+// SortedList.h
+// This SortedList is listed from SMALL to BIG
+// ex: 1 < 3 < 5 < 7
+//	   a < f < m < s
+// Compare changes what SMALL means (ex: greater<ItemType> lists from BIG to SMALL, see SortedList2.h).
+// Two entries are the same for getPosition() and removeSorted() when neither comes before the other.
+#ifndef _SORTED_LIST_H_
+#define _SORTED_LIST_H_
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "Node.h"
+#include "ArrayScan.h"
+#include "ArrayStorage.h"
+using namespace std;
+
+template<class ItemType>
+class SortedListInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual int getLength() const = 0;
+	virtual bool remove(int position) = 0;
+	virtual void clear() = 0;
+	virtual ItemType getEntry(int position) const = 0;
+	virtual void insertSorted(const ItemType& newEntry) = 0;
+	virtual bool removeSorted(const ItemType& anEntry) = 0;
+	virtual int getPosition(const ItemType& anEntry) const = 0;
+};
+
+template<class ItemType, class Allocator = NodeAllocator<ItemType>, class Compare = less<ItemType> >
+class LinkedSortedList : public SortedListInterface<ItemType>
+{
+private:
+	Node<ItemType>* headPtr;
+	int itemCount;
+	Allocator nodeAlloc; // source of the nodes (ex: NodePool<ItemType>)
+	Compare compare;
+
+	Node<ItemType>* getNodeAt(int position) const;
+	Node<ItemType>* getNodeBefore(const ItemType& anEntry) const;
+	Node<ItemType>* mergeChains(Node<ItemType>* firstChainPtr, Node<ItemType>* secondChainPtr) const;
+	Node<ItemType>* sortChain(Node<ItemType>* chainPtr, int length) const;
+public:
+	// the items cannot be changed in place: that could break the order
+	typedef NodeIterator<ItemType, const ItemType> iterator;
+	typedef NodeIterator<ItemType, const ItemType> const_iterator;
+
+	// A place in the list, to walk it once and edit as you go: insertAfter() and removeAfter()
+	// are O(1) at the cursor, where insertSorted() and remove() walk from headPtr.
+	// insertAfter() only takes an entry that keeps the list sorted there.
+	// A cursor stays valid until the item at the cursor is removed.
+	class Cursor
+	{
+	private:
+		LinkedSortedList<ItemType, Allocator, Compare>* listPtr;
+		Node<ItemType>* curPtr; // the item at the cursor; nullptr before the first item
+
+		Cursor(LinkedSortedList<ItemType, Allocator, Compare>* aListPtr, Node<ItemType>* nodePtr);
+		Node<ItemType>*& nextLink() const; // the pointer to the item after the cursor
+		bool fitsAfter(const ItemType& newEntry) const;
+		void linkAfter(Node<ItemType>* newNodePtr);
+		friend class LinkedSortedList<ItemType, Allocator, Compare>;
+	public:
+		bool hasNext() const;             // is there an item after the cursor
+		bool advance();                   // moves to the next item; false at the last one
+		const ItemType& getEntry() const; // the item at the cursor
+		bool insertAfter(const ItemType& newEntry); // false if newEntry does not go here; the cursor stays
+		bool insertAfter(ItemType&& newEntry);
+		template<class... Args>
+		bool emplaceAfter(Args&&... args); // builds the entry first, and drops it if it does not go here
+		bool removeAfter();               // false if there is no item after the cursor
+	};
+
+	LinkedSortedList();
+	template<class InputIterator>
+	LinkedSortedList(InputIterator first, InputIterator last);
+	LinkedSortedList(const LinkedSortedList<ItemType, Allocator, Compare>& aSList);
+	LinkedSortedList(LinkedSortedList<ItemType, Allocator, Compare>&& aSList);
+	~LinkedSortedList();
+	bool isEmpty() const;
+	int getLength() const;
+	bool remove(int position);
+	void clear();
+	ItemType getEntry(int position) const;
+	void insertSorted(const ItemType& newEntry);
+	void insertSorted(ItemType&& newEntry);
+	template<class... Args>
+	void emplaceSorted(Args&&... args); // builds the new entry in place
+	template<class InputIterator>
+	void insertSorted(InputIterator first, InputIterator last); // sorts the new items, then merges once
+	bool removeSorted(const ItemType& anEntry);
+	int getPosition(const ItemType& anEntry) const;
+	const_iterator begin() const;
+	const_iterator end() const;
+	Cursor getCursorAt(int position); // at the item at position; position 0 is before the first item
+	const LinkedSortedList<ItemType, Allocator, Compare>& operator=(LinkedSortedList<ItemType, Allocator, Compare>&& aSList);
+};
+
+template<class ItemType, class Compare = less<ItemType> >
+class ArraySortedList : public SortedListInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 100;
+	ItemType* items; // uninitialized past itemCount
+	int itemCount;
+	int maxItems;
+	Compare compare;
+public:
+	// the items cannot be changed in place: that could break the order
+	typedef const ItemType* iterator;
+	typedef const ItemType* const_iterator;
+
+	ArraySortedList();
+	template<class InputIterator>
+	ArraySortedList(InputIterator first, InputIterator last);
+	ArraySortedList(const ArraySortedList<ItemType, Compare>& aSList);
+	ArraySortedList(ArraySortedList<ItemType, Compare>&& aSList);
+	~ArraySortedList();
+	bool isEmpty() const;
+	int getLength() const;
+	bool remove(int position);
+	void clear();
+	ItemType getEntry(int position) const;
+	void insertSorted(const ItemType& newEntry);
+	void insertSorted(ItemType&& newEntry);
+	template<class... Args>
+	void emplaceSorted(Args&&... args);
+	template<class InputIterator>
+	void insertSorted(InputIterator first, InputIterator last); // sorts the new items, then merges once
+	bool removeSorted(const ItemType& anEntry);
+	int getPosition(const ItemType& anEntry) const;
+	void reserve(int newCapacity); // makes room for newCapacity items (never shrinks)
+	void shrink_to_fit();          // gives back the capacity past getLength()
+	const_iterator begin() const;
+	const_iterator end() const;
+	const ArraySortedList<ItemType, Compare>& operator=(ArraySortedList<ItemType, Compare>&& aSList);
+};
+
+//=================================================================================================
+// LinkedSortedList
+//=================================================================================================
+template<class ItemType, class Allocator, class Compare>
+LinkedSortedList<ItemType, Allocator, Compare>::LinkedSortedList() : headPtr(nullptr), itemCount(0)
+{
+}
+
+template<class ItemType, class Allocator, class Compare>
+template<class InputIterator>
+LinkedSortedList<ItemType, Allocator, Compare>::LinkedSortedList(InputIterator first, InputIterator last) : headPtr(nullptr), itemCount(0)
+{
+	insertSorted(first, last);
+}
+
+template<class ItemType, class Allocator, class Compare>
+LinkedSortedList<ItemType, Allocator, Compare>::LinkedSortedList(const LinkedSortedList<ItemType, Allocator, Compare>& aSList)
+{
+	itemCount = aSList.itemCount;
+	Node<ItemType>* origChainPtr = aSList.headPtr; // Points to nodes in original chain
+
+	if (origChainPtr == nullptr)
+		headPtr = nullptr;  // Original SList is empty; so is copy
+	else
+	{
+		// Copy first node
+		headPtr = nodeAlloc.allocate(origChainPtr->item);
+
+		// Copy remaining nodes
+		Node<ItemType>* newChainPtr = headPtr;
+		origChainPtr = origChainPtr->next;
+		while (origChainPtr != nullptr)
+		{
+			newChainPtr->next = nodeAlloc.allocate(origChainPtr->item);
+			newChainPtr = newChainPtr->next;
+			origChainPtr = origChainPtr->next;
+		}
+
+		newChainPtr->next = nullptr; // Flag end of new chain
+	}
+}
+
+template<class ItemType, class Allocator, class Compare>
+LinkedSortedList<ItemType, Allocator, Compare>::LinkedSortedList(LinkedSortedList<ItemType, Allocator, Compare>&& aSList)
+	: headPtr(aSList.headPtr), itemCount(aSList.itemCount), nodeAlloc(move(aSList.nodeAlloc))
+{
+	aSList.headPtr = nullptr;
+	aSList.itemCount = 0;
+}
+
+template<class ItemType, class Allocator, class Compare>
+LinkedSortedList<ItemType, Allocator, Compare>::~LinkedSortedList()
+{
+	clear();
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, class Allocator, class Compare>
+int LinkedSortedList<ItemType, Allocator, Compare>::getLength() const
+{
+	return itemCount;
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::remove(int position)
+{
+	bool ableToRemove = (1 <= position) && (position <= itemCount);
+	if(ableToRemove)
+	{
+		Node<ItemType>* curPtr = nullptr;
+		if(position == 1)
+		{
+			curPtr = headPtr;
+			headPtr = headPtr->next;
+		}
+		else
+		{
+			Node<ItemType>* prevNodePtr = getNodeAt(position - 1);
+			curPtr = prevNodePtr->next;
+			prevNodePtr->next = curPtr->next;
+		}
+		curPtr->next = nullptr;
+		nodeAlloc.deallocate(curPtr);
+		curPtr = nullptr;
+		itemCount--;
+	}
+	return ableToRemove;
+}
+
+template<class ItemType, class Allocator, class Compare>
+void LinkedSortedList<ItemType, Allocator, Compare>::clear()
+{
+	nodeAlloc.deallocateAll(headPtr); // release the whole chain at once
+	headPtr = nullptr;
+	itemCount = 0;
+}
+
+template<class ItemType, class Allocator, class Compare>
+ItemType LinkedSortedList<ItemType, Allocator, Compare>::getEntry(int position) const
+{
+	bool ableToGet = (1 <= position) && (position <= itemCount);
+	if(ableToGet)
+	{
+		Node<ItemType>* nodePtr = getNodeAt(position);
+		return nodePtr->item;
+	}
+	else
+		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType, class Allocator, class Compare>
+void LinkedSortedList<ItemType, Allocator, Compare>::insertSorted(const ItemType& newEntry)
+{
+	emplaceSorted(newEntry);
+}
+
+template<class ItemType, class Allocator, class Compare>
+void LinkedSortedList<ItemType, Allocator, Compare>::insertSorted(ItemType&& newEntry)
+{
+	emplaceSorted(move(newEntry));
+}
+
+template<class ItemType, class Allocator, class Compare>
+template<class... Args>
+void LinkedSortedList<ItemType, Allocator, Compare>::emplaceSorted(Args&&... args)
+{
+	Node<ItemType>* newNodePtr = nodeAlloc.emplace(nullptr, forward<Args>(args)...);
+	Node<ItemType>* prevPtr = getNodeBefore(newNodePtr->item);
+
+	if(isEmpty() || (prevPtr == nullptr))
+	{
+		newNodePtr->next = headPtr;
+		headPtr = newNodePtr;
+	}
+	else
+	{
+		Node<ItemType>* aftPtr = prevPtr->next;
+		newNodePtr->next = aftPtr;
+		prevPtr->next = newNodePtr;
+	}
+
+	itemCount++;
+}
+
+template<class ItemType, class Allocator, class Compare>
+template<class InputIterator>
+void LinkedSortedList<ItemType, Allocator, Compare>::insertSorted(InputIterator first, InputIterator last)
+{
+	// chain the new items, sort that chain, then merge it into ours in one pass
+	Node<ItemType>* newChainPtr = nullptr;
+	Node<ItemType>* newBackPtr = nullptr;
+	int newCount = 0;
+	try
+	{
+		for(; first != last; ++first)
+		{
+			Node<ItemType>* newNodePtr = nodeAlloc.emplace(nullptr, *first);
+			if(newBackPtr == nullptr)
+				newChainPtr = newNodePtr;
+			else
+				newBackPtr->next = newNodePtr;
+			newBackPtr = newNodePtr;
+			newCount++;
+		}
+	}
+	catch(...)
+	{
+		while(newChainPtr != nullptr)
+		{
+			Node<ItemType>* nodeToDeletePtr = newChainPtr;
+			newChainPtr = newChainPtr->next;
+			nodeAlloc.deallocate(nodeToDeletePtr);
+		}
+		throw;
+	}
+
+	headPtr = mergeChains(sortChain(newChainPtr, newCount), headPtr);
+	itemCount += newCount;
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::removeSorted(const ItemType& anEntry)
+{
+	if((headPtr == nullptr) || compare(anEntry, headPtr->item)) // empty, or anEntry goes before all
+		return false;
+	else if(!compare(headPtr->item, anEntry)) // bingo at first one
+	{
+		Node<ItemType>* targetPtr = headPtr;
+		headPtr = headPtr->next;
+
+		targetPtr->next = nullptr;
+		nodeAlloc.deallocate(targetPtr);
+		targetPtr = nullptr;
+
+		itemCount--;
+		return true;
+	}
+	else
+	{
+		Node<ItemType>* prevPtr = getNodeBefore(anEntry); // not nullptr: the first one goes before anEntry
+		Node<ItemType>* targetPtr = prevPtr->next;
+		bool ableToRemoveSorted = (targetPtr != nullptr) &&
+								  !compare(anEntry, targetPtr->item);
+		if(ableToRemoveSorted)
+		{
+			prevPtr->next = targetPtr->next;
+
+			targetPtr->next = nullptr;
+			nodeAlloc.deallocate(targetPtr);
+			targetPtr = nullptr;
+
+			itemCount--;
+		}
+		return ableToRemoveSorted;
+	}
+}
+
+template<class ItemType, class Allocator, class Compare>
+int LinkedSortedList<ItemType, Allocator, Compare>::getPosition(const ItemType& anEntry) const
+{
+	Node<ItemType>* curPtr = headPtr;
+	int positionCnt = 1;
+
+	while((curPtr != nullptr) && compare(curPtr->item, anEntry))
+	{
+		curPtr = curPtr->next;
+		positionCnt++;
+	}
+	if(curPtr == nullptr) // empty list or traverse to the end
+		return -positionCnt;
+	else if (compare(anEntry, curPtr->item)) // not bingo
+		return -positionCnt;
+	else  // the same entry as anEntry // bingo
+		return positionCnt;
+}
+
+template<class ItemType, class Allocator, class Compare>
+typename LinkedSortedList<ItemType, Allocator, Compare>::const_iterator LinkedSortedList<ItemType, Allocator, Compare>::begin() const
+{
+	return const_iterator(headPtr);
+}
+
+template<class ItemType, class Allocator, class Compare>
+typename LinkedSortedList<ItemType, Allocator, Compare>::const_iterator LinkedSortedList<ItemType, Allocator, Compare>::end() const
+{
+	return const_iterator();
+}
+
+template<class ItemType, class Allocator, class Compare>
+typename LinkedSortedList<ItemType, Allocator, Compare>::Cursor LinkedSortedList<ItemType, Allocator, Compare>::getCursorAt(int position)
+{
+	bool ableToGet = (0 <= position) && (position <= itemCount);
+	if(ableToGet)
+		return Cursor(this, (position == 0) ? nullptr : getNodeAt(position));
+	else
+		throw logic_error("Precondition Violated Exception: getCursorAt() called with an invalid position.\n");
+}
+
+template<class ItemType, class Allocator, class Compare>
+const LinkedSortedList<ItemType, Allocator, Compare>& LinkedSortedList<ItemType, Allocator, Compare>::operator=(LinkedSortedList<ItemType, Allocator, Compare>&& aSList)
+{
+	if (this != &aSList)
+	{
+		clear();
+		headPtr = aSList.headPtr;
+		itemCount = aSList.itemCount;
+		nodeAlloc = move(aSList.nodeAlloc);
+		aSList.headPtr = nullptr;
+		aSList.itemCount = 0;
+	}
+	return *this;
+}
+
+template<class ItemType, class Allocator, class Compare>
+Node<ItemType>* LinkedSortedList<ItemType, Allocator, Compare>::getNodeAt(int position) const
+{
+	if((position < 1) || (position > itemCount))
+		throw out_of_range("out_of_range exception called at getNodeAt()\n");
+
+	Node<ItemType>* curPtr = headPtr;
+	for (int i = 1; i < position; i++)
+		curPtr = curPtr->next;
+	return curPtr;
+}
+
+template<class ItemType, class Allocator, class Compare>
+Node<ItemType>* LinkedSortedList<ItemType, Allocator, Compare>::getNodeBefore(const ItemType& anEntry) const
+{
+	Node<ItemType>* curPtr = headPtr;
+	Node<ItemType>* prevPtr = nullptr;
+
+	while((curPtr != nullptr) && compare(curPtr->item, anEntry))
+	{
+		prevPtr = curPtr;
+		curPtr = curPtr->next;
+	}
+
+	return prevPtr;
+}
+
+// private: merges two sorted chains; on ties the node of firstChainPtr goes first
+template<class ItemType, class Allocator, class Compare>
+Node<ItemType>* LinkedSortedList<ItemType, Allocator, Compare>::mergeChains(Node<ItemType>* firstChainPtr, Node<ItemType>* secondChainPtr) const
+{
+	Node<ItemType>* mergedPtr = nullptr;
+	Node<ItemType>** tailPtr = &mergedPtr; // the link to fill next
+	while((firstChainPtr != nullptr) && (secondChainPtr != nullptr))
+	{
+		if(compare(secondChainPtr->item, firstChainPtr->item))
+		{
+			*tailPtr = secondChainPtr;
+			secondChainPtr = secondChainPtr->next;
+		}
+		else
+		{
+			*tailPtr = firstChainPtr;
+			firstChainPtr = firstChainPtr->next;
+		}
+		tailPtr = &((*tailPtr)->next);
+	}
+	*tailPtr = (firstChainPtr != nullptr) ? firstChainPtr : secondChainPtr;
+	return mergedPtr;
+}
+
+// private: merge sort of the first length nodes of chainPtr (the whole chain)
+template<class ItemType, class Allocator, class Compare>
+Node<ItemType>* LinkedSortedList<ItemType, Allocator, Compare>::sortChain(Node<ItemType>* chainPtr, int length) const
+{
+	if(length <= 1)
+		return chainPtr;
+
+	Node<ItemType>* lastOfFirstHalf = chainPtr;
+	for(int i = 1; i < length / 2; i++)
+		lastOfFirstHalf = lastOfFirstHalf->next;
+	Node<ItemType>* secondHalfPtr = lastOfFirstHalf->next;
+	lastOfFirstHalf->next = nullptr;
+
+	return mergeChains(sortChain(chainPtr, length / 2), sortChain(secondHalfPtr, length - length / 2));
+}
+
+//=================================================================================================
+// LinkedSortedList::Cursor
+//=================================================================================================
+template<class ItemType, class Allocator, class Compare>
+LinkedSortedList<ItemType, Allocator, Compare>::Cursor::Cursor(LinkedSortedList<ItemType, Allocator, Compare>* aListPtr, Node<ItemType>* nodePtr)
+	: listPtr(aListPtr), curPtr(nodePtr)
+{
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::hasNext() const
+{
+	return (nextLink() != nullptr);
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::advance()
+{
+	Node<ItemType>* nextNodePtr = nextLink();
+	if(nextNodePtr == nullptr)
+		return false;
+	curPtr = nextNodePtr;
+	return true;
+}
+
+template<class ItemType, class Allocator, class Compare>
+const ItemType& LinkedSortedList<ItemType, Allocator, Compare>::Cursor::getEntry() const
+{
+	if(curPtr == nullptr)
+		throw logic_error("Precondition Violated Exception: getEntry() called with a cursor before the first item.\n");
+	return curPtr->item;
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::insertAfter(const ItemType& newEntry)
+{
+	bool ableToInsert = fitsAfter(newEntry);
+	if(ableToInsert)
+		linkAfter(listPtr->nodeAlloc.allocate(newEntry));
+	return ableToInsert;
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::insertAfter(ItemType&& newEntry)
+{
+	bool ableToInsert = fitsAfter(newEntry); // checked first: newEntry is only moved from if it goes in
+	if(ableToInsert)
+		linkAfter(listPtr->nodeAlloc.allocate(move(newEntry)));
+	return ableToInsert;
+}
+
+template<class ItemType, class Allocator, class Compare>
+template<class... Args>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::emplaceAfter(Args&&... args)
+{
+	Node<ItemType>* newNodePtr = listPtr->nodeAlloc.emplace(nullptr, forward<Args>(args)...);
+	bool ableToInsert = fitsAfter(newNodePtr->item);
+	if(ableToInsert)
+		linkAfter(newNodePtr);
+	else
+		listPtr->nodeAlloc.deallocate(newNodePtr);
+	return ableToInsert;
+}
+
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::removeAfter()
+{
+	Node<ItemType>*& link = nextLink();
+	Node<ItemType>* nodeToDeletePtr = link;
+	if(nodeToDeletePtr == nullptr)
+		return false;
+
+	link = nodeToDeletePtr->next;
+	nodeToDeletePtr->next = nullptr;
+	listPtr->nodeAlloc.deallocate(nodeToDeletePtr);
+	listPtr->itemCount--;
+	return true;
+}
+
+// private member function of LinkedSortedList::Cursor
+template<class ItemType, class Allocator, class Compare>
+Node<ItemType>*& LinkedSortedList<ItemType, Allocator, Compare>::Cursor::nextLink() const
+{
+	return (curPtr == nullptr) ? listPtr->headPtr : curPtr->next;
+}
+
+// private member function of LinkedSortedList::Cursor
+// newEntry goes between the item at the cursor and the next one when neither comes after it
+// and before it; ties are fine on either side
+template<class ItemType, class Allocator, class Compare>
+bool LinkedSortedList<ItemType, Allocator, Compare>::Cursor::fitsAfter(const ItemType& newEntry) const
+{
+	Node<ItemType>* nextNodePtr = nextLink();
+	return ((curPtr == nullptr) || !listPtr->compare(newEntry, curPtr->item)) &&
+		   ((nextNodePtr == nullptr) || !listPtr->compare(nextNodePtr->item, newEntry));
+}
+
+// private member function of LinkedSortedList::Cursor
+template<class ItemType, class Allocator, class Compare>
+void LinkedSortedList<ItemType, Allocator, Compare>::Cursor::linkAfter(Node<ItemType>* newNodePtr)
+{
+	Node<ItemType>*& link = nextLink();
+	newNodePtr->next = link;
+	link = newNodePtr;
+	listPtr->itemCount++;
+}
+
+//=================================================================================================
+// ArraySortedList
+//=================================================================================================
+template<class ItemType, class Compare>
+ArraySortedList<ItemType, Compare>::ArraySortedList() : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+ArraySortedList<ItemType, Compare>::ArraySortedList(InputIterator first, InputIterator last) : itemCount(0), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+	insertSorted(first, last);
+}
+
+template<class ItemType, class Compare>
+ArraySortedList<ItemType, Compare>::ArraySortedList(const ArraySortedList<ItemType, Compare>& aSList)
+{
+	itemCount = aSList.itemCount;
+	maxItems = aSList.maxItems;
+	items = allocateItems<ItemType>(maxItems);
+	copyItems(items, aSList.items, itemCount);
+}
+
+template<class ItemType, class Compare>
+ArraySortedList<ItemType, Compare>::ArraySortedList(ArraySortedList<ItemType, Compare>&& aSList)
+	: items(aSList.items), itemCount(aSList.itemCount), maxItems(aSList.maxItems)
+{
+	// aSList is left empty with no capacity; its next insertSorted() allocates again
+	aSList.items = nullptr;
+	aSList.itemCount = 0;
+	aSList.maxItems = 0;
+}
+
+template<class ItemType, class Compare>
+ArraySortedList<ItemType, Compare>::~ArraySortedList()
+{
+	destroyItems(items, 0, itemCount);
+	freeItems(items);
+}
+
+template<class ItemType, class Compare>
+bool ArraySortedList<ItemType, Compare>::isEmpty() const
+{
+	return (itemCount == 0);
+}
+
+template<class ItemType, class Compare>
+int ArraySortedList<ItemType, Compare>::getLength() const
+{
+	return itemCount;
+}
+
+template<class ItemType, class Compare>
+bool ArraySortedList<ItemType, Compare>::remove(int position)
+{
+	bool ableToRemove = (1 <= position) && (position <= itemCount);
+	if(ableToRemove)
+	{
+		// delete item by shifting
+		for(int i = position; i < itemCount; i++)
+			items[i - 1] = move(items[i]);
+		itemCount--; // decrease count of entries
+		destroyItems(items, itemCount, itemCount + 1);
+	}
+	return ableToRemove;
+}
+
+template<class ItemType, class Compare>
+void ArraySortedList<ItemType, Compare>::clear()
+{
+	destroyItems(items, 0, itemCount);
+	itemCount = 0;
+}
+
+template<class ItemType, class Compare>
+ItemType ArraySortedList<ItemType, Compare>::getEntry(int position) const
+{
+	bool ableToGet = (1 <= position) && (position <= itemCount);
+	if(ableToGet)
+		return items[position - 1];
+	else
+		throw logic_error("Precondition Violated Exception: getEntry() called with an empty list or invalid position.\n");
+}
+
+template<class ItemType, class Compare>
+void ArraySortedList<ItemType, Compare>::insertSorted(const ItemType& newEntry)
+{
+	emplaceSorted(newEntry);
+}
+
+template<class ItemType, class Compare>
+void ArraySortedList<ItemType, Compare>::insertSorted(ItemType&& newEntry)
+{
+	emplaceSorted(move(newEntry));
+}
+
+template<class ItemType, class Compare>
+template<class... Args>
+void ArraySortedList<ItemType, Compare>::emplaceSorted(Args&&... args)
+{
+	ItemType newEntry(forward<Args>(args)...); // before growing: args may refer into items
+	bool hasRoomToAdd = (itemCount < maxItems);
+	if(!hasRoomToAdd)
+		reserve((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+	int newPosition = arrayCountBefore(items, itemCount, newEntry, compare) + 1;
+	if(newPosition == itemCount + 1)
+		new (&items[itemCount]) ItemType(move(newEntry));
+	else
+	{
+		// make room for new item by shifting; the last slot is not constructed yet
+		new (&items[itemCount]) ItemType(move(items[itemCount - 1]));
+		for(int i = itemCount - 1; i >= newPosition; i--)
+			items[i] = move(items[i - 1]);
+		// insert new item
+		items[newPosition - 1] = move(newEntry);
+	}
+	itemCount++; // increase the size of the list by one
+}
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+void ArraySortedList<ItemType, Compare>::insertSorted(InputIterator first, InputIterator last)
+{
+	// append the new items in one pass, sort them, then merge the two sorted runs
+	int oldCount = itemCount;
+	int count = rangeLength(first, last);
+	if(count > 0 && itemCount + count > maxItems)
+		reserve(grownCapacity(maxItems, itemCount + count));
+	try
+	{
+		for(; first != last; ++first)
+		{
+			if(itemCount == maxItems) // only for single-pass ranges
+				reserve(grownCapacity(maxItems, itemCount + 1));
+			new (&items[itemCount]) ItemType(*first);
+			itemCount++;
+		}
+	}
+	catch(...)
+	{
+		// drop the unsorted tail, so the list is left as it was
+		destroyItems(items, oldCount, itemCount);
+		itemCount = oldCount;
+		throw;
+	}
+	sort(items + oldCount, items + itemCount, compare);
+	inplace_merge(items, items + oldCount, items + itemCount, compare);
+}
+
+template<class ItemType, class Compare>
+bool ArraySortedList<ItemType, Compare>::removeSorted(const ItemType& anEntry)
+{
+	int position = getPosition(anEntry);
+	if(position < 0) // not in the list
+		return false;
+	return remove(position);
+}
+
+template<class ItemType, class Compare>
+int ArraySortedList<ItemType, Compare>::getPosition(const ItemType& anEntry) const
+{
+	int i = arrayCountBefore(items, itemCount, anEntry, compare);
+	if((i < itemCount) && !compare(anEntry, items[i])) // bingo
+		return i + 1;
+	else
+		return -(i + 1);
+}
+
+template<class ItemType, class Compare>
+void ArraySortedList<ItemType, Compare>::reserve(int newCapacity)
+{
+	if(newCapacity > maxItems)
+	{
+		items = reallocateItems(items, itemCount, newCapacity);
+		maxItems = newCapacity;
+	}
+}
+
+template<class ItemType, class Compare>
+void ArraySortedList<ItemType, Compare>::shrink_to_fit()
+{
+	if(itemCount < maxItems)
+	{
+		items = reallocateItems(items, itemCount, itemCount);
+		maxItems = itemCount;
+	}
+}
+
+template<class ItemType, class Compare>
+typename ArraySortedList<ItemType, Compare>::const_iterator ArraySortedList<ItemType, Compare>::begin() const
+{
+	return items;
+}
+
+template<class ItemType, class Compare>
+typename ArraySortedList<ItemType, Compare>::const_iterator ArraySortedList<ItemType, Compare>::end() const
+{
+	return items + itemCount;
+}
+
+template<class ItemType, class Compare>
+const ArraySortedList<ItemType, Compare>& ArraySortedList<ItemType, Compare>::operator=(ArraySortedList<ItemType, Compare>&& aSList)
+{
+	if (this != &aSList)
+	{
+		destroyItems(items, 0, itemCount);
+		freeItems(items);
+		items = aSList.items;
+		itemCount = aSList.itemCount;
+		maxItems = aSList.maxItems;
+		aSList.items = nullptr;
+		aSList.itemCount = 0;
+		aSList.maxItems = 0;
+	}
+	return *this;
+}
+#endif // !_SORTED_LIST_H_
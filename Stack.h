@@ -1,202 +1,362 @@
-// Stack.h
-#ifndef _STACK_H_
-#define _STACK_H_
-#include <stdexcept>
-#include "Node.h"
-using namespace std;
-
-template<class ItemType>
-class StackInterface
-{
-public:
-	virtual bool isEmpty() const = 0;
-	virtual bool push(const ItemType& newEntry) = 0;
-	virtual bool pop() = 0;
-	virtual ItemType peek() const = 0;
-};
-
-template<class ItemType>
-class LinkedStack : public StackInterface<ItemType>
-{
-private:
-	Node<ItemType>* topPtr;
-public:
-	LinkedStack();
-	LinkedStack(const LinkedStack<ItemType>& aStack);	
-	~LinkedStack();
-	bool isEmpty() const;
-	bool push(const ItemType& newEntry);
-	bool pop();
-	ItemType peek() const;
-};
-
-template<class ItemType>
-class ArrayStack : public StackInterface<ItemType>
-{
-private:
-	static const int DEFAULT_CAPACITY = 10;
-	ItemType* items;
-	int top;
-	int maxItems;
-public:
-	ArrayStack();
-	ArrayStack(const ArrayStack& aStack);
-	~ArrayStack();
-	bool isEmpty() const;
-	bool push(const ItemType& newEntry);
-	bool pop();
-	ItemType peek() const;
-};
-
-//=================================================================================================
-// LinkedStack
-//=================================================================================================
-template<class ItemType>
-LinkedStack<ItemType>::LinkedStack() : topPtr(nullptr)
-{
-}
-
-template<class ItemType>
-LinkedStack<ItemType>::LinkedStack(const LinkedStack<ItemType>& aStack)
-{
-	Node<ItemType>* origChainPtr = aStack.topPtr;
-	if (origChainPtr == nullptr)
-		topPtr = nullptr;
-	else
-	{	// copy first node
-		topPtr = new Node<ItemType>(origChainPtr->item);
-
-		// copy remaining nodes
-		Node<ItemType>* newChainPtr = topPtr;
-		origChainPtr = origChainPtr->next;
-		while (origChainPtr != nullptr)
-		{
-			newChainPtr->next = new Node<ItemType>(origChainPtr->item);
-			newChainPtr = newChainPtr->next;
-			origChainPtr = origChainPtr->next;
-		}
-
-		newChainPtr->next = nullptr; // Flag end of new chain
-	}
-}
-
-template<class ItemType>
-LinkedStack<ItemType>::~LinkedStack()
-{
-	while (!isEmpty())
-		pop();
-}
-
-template<class ItemType>
-bool LinkedStack<ItemType>::isEmpty() const
-{
-	return (topPtr == nullptr);
-}
-
-template<class ItemType>
-bool LinkedStack<ItemType>::push(const ItemType& newItem)
-{
-	Node<ItemType>* newNodePtr = new Node<ItemType>(newItem, topPtr);
-	topPtr = newNodePtr;
-	newNodePtr = nullptr;
-
-	return true;
-}
-
-template<class ItemType>
-bool LinkedStack<ItemType>::pop()
-{
-	if (!isEmpty())
-	{
-		Node<ItemType>* nodeToDeletePtr = topPtr;
-		topPtr = topPtr->next;
-
-		nodeToDeletePtr->next = nullptr;
-		delete nodeToDeletePtr;
-		nodeToDeletePtr = nullptr;
-
-		return true;
-	}
-	return false;
-}
-
-template<class ItemType>
-ItemType LinkedStack<ItemType>::peek() const
-{
-	if (isEmpty())
-		throw logic_error("Precondition Violated Exception: peek() called with an empty stack.\n");
-
-	return topPtr->item;
-}
-
-//=================================================================================================
-// ArrayStack
-//=================================================================================================
-template<class ItemType>
-ArrayStack<ItemType>::ArrayStack() : top(-1), maxItems(DEFAULT_CAPACITY)
-{
-	items = new ItemType[maxItems];
-}
-
-template<class ItemType>
-ArrayStack<ItemType>::ArrayStack(const ArrayStack& aStack)
-{
-	top = aStack.top;
-	maxItems = aStack.maxItems;
-	items = new ItemType[maxItems];
-	for (int i = 0 ; i <= top ; i++) {
-		items[i] = aStack.items[i];
-	}
-}
-
-template<class ItemType>
-ArrayStack<ItemType>::~ArrayStack()
-{
-	delete[] items;
-}
-
-template<class ItemType>
-bool ArrayStack<ItemType>::isEmpty() const
-{
-	return (top < 0);
-}
-
-template<class ItemType>
-bool ArrayStack<ItemType>::push(const ItemType& newEntry)
-{
-	bool hasRoomToAdd = (top < maxItems - 1);
-	if (!hasRoomToAdd)
-	{
-		ItemType* oldArray = items;
-		items = new ItemType[2 * maxItems];
-		for (int i = 0; i < maxItems; i++)
-			items[i] = oldArray[i];
-		delete[] oldArray;
-		maxItems *= 2;
-	}
-	top++;
-	items[top] = newEntry;
-
-	return true;
-}
-
-template<class ItemType>
-bool ArrayStack<ItemType>::pop()
-{
-	if (!isEmpty())
-	{
-		top--;
-		return true;
-	}
-	return false;
-}
-
-template<class ItemType>
-ItemType ArrayStack<ItemType>::peek() const
-{
-	if (isEmpty())
-		throw logic_error("Precondition Violated Exception: peek() called with an empty stack.\n");
-
-	return items[top];
-}
-#endif // !_STACK_H_
+// Stack.h
+#ifndef _STACK_H_
+#define _STACK_H_
+#include <stdexcept>
+#include <utility>
+#include "Node.h"
+#include "ArrayStorage.h"
+using namespace std;
+
+template<class ItemType>
+class StackInterface
+{
+public:
+	virtual bool isEmpty() const = 0;
+	virtual bool push(const ItemType& newEntry) = 0;
+	virtual bool pop() = 0;
+	virtual ItemType peek() const = 0;
+};
+
+template<class ItemType, class Allocator = NodeAllocator<ItemType> >
+class LinkedStack : public StackInterface<ItemType>
+{
+private:
+	Node<ItemType>* topPtr;
+	Allocator nodeAlloc; // source of the nodes (ex: NodePool<ItemType>)
+public:
+	LinkedStack();
+	template<class InputIterator>
+	LinkedStack(InputIterator first, InputIterator last); // *(last - 1) ends up on top
+	LinkedStack(const LinkedStack<ItemType, Allocator>& aStack);	
+	LinkedStack(LinkedStack<ItemType, Allocator>&& aStack);
+	~LinkedStack();
+	bool isEmpty() const;
+	bool push(const ItemType& newEntry);
+	bool push(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args); // builds the new top in place
+	template<class InputIterator>
+	bool pushMany(InputIterator first, InputIterator last); // pushes [first, last) in order
+	bool pop();
+	ItemType peek() const;
+	const LinkedStack<ItemType, Allocator>& operator=(LinkedStack<ItemType, Allocator>&& aStack);
+};
+
+template<class ItemType>
+class ArrayStack : public StackInterface<ItemType>
+{
+private:
+	static const int DEFAULT_CAPACITY = 10;
+	ItemType* items; // uninitialized past top
+	int top;
+	int maxItems;
+public:
+	ArrayStack();
+	template<class InputIterator>
+	ArrayStack(InputIterator first, InputIterator last); // *(last - 1) ends up on top
+	ArrayStack(const ArrayStack& aStack);
+	ArrayStack(ArrayStack&& aStack);
+	~ArrayStack();
+	bool isEmpty() const;
+	bool push(const ItemType& newEntry);
+	bool push(ItemType&& newEntry);
+	template<class... Args>
+	bool emplace(Args&&... args);
+	template<class InputIterator>
+	bool pushMany(InputIterator first, InputIterator last); // pushes [first, last) in order
+	bool pop();
+	ItemType peek() const;
+	void reserve(int newCapacity); // makes room for newCapacity items (never shrinks)
+	void shrink_to_fit();          // gives back the capacity above top
+	const ArrayStack<ItemType>& operator=(ArrayStack<ItemType>&& aStack);
+};
+
+//=================================================================================================
+// LinkedStack
+//=================================================================================================
+template<class ItemType, class Allocator>
+LinkedStack<ItemType, Allocator>::LinkedStack() : topPtr(nullptr)
+{
+}
+
+template<class ItemType, class Allocator>
+template<class InputIterator>
+LinkedStack<ItemType, Allocator>::LinkedStack(InputIterator first, InputIterator last) : topPtr(nullptr)
+{
+	pushMany(first, last);
+}
+
+template<class ItemType, class Allocator>
+LinkedStack<ItemType, Allocator>::LinkedStack(const LinkedStack<ItemType, Allocator>& aStack)
+{
+	Node<ItemType>* origChainPtr = aStack.topPtr;
+	if (origChainPtr == nullptr)
+		topPtr = nullptr;
+	else
+	{	// copy first node
+		topPtr = nodeAlloc.allocate(origChainPtr->item);
+
+		// copy remaining nodes
+		Node<ItemType>* newChainPtr = topPtr;
+		origChainPtr = origChainPtr->next;
+		while (origChainPtr != nullptr)
+		{
+			newChainPtr->next = nodeAlloc.allocate(origChainPtr->item);
+			newChainPtr = newChainPtr->next;
+			origChainPtr = origChainPtr->next;
+		}
+
+		newChainPtr->next = nullptr; // Flag end of new chain
+	}
+}
+
+template<class ItemType, class Allocator>
+LinkedStack<ItemType, Allocator>::LinkedStack(LinkedStack<ItemType, Allocator>&& aStack)
+	: topPtr(aStack.topPtr), nodeAlloc(move(aStack.nodeAlloc))
+{
+	aStack.topPtr = nullptr;
+}
+
+template<class ItemType, class Allocator>
+LinkedStack<ItemType, Allocator>::~LinkedStack()
+{
+	nodeAlloc.deallocateAll(topPtr); // release the whole chain at once
+	topPtr = nullptr;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedStack<ItemType, Allocator>::isEmpty() const
+{
+	return (topPtr == nullptr);
+}
+
+template<class ItemType, class Allocator>
+bool LinkedStack<ItemType, Allocator>::push(const ItemType& newItem)
+{
+	Node<ItemType>* newNodePtr = nodeAlloc.allocate(newItem, topPtr);
+	topPtr = newNodePtr;
+	newNodePtr = nullptr;
+
+	return true;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedStack<ItemType, Allocator>::push(ItemType&& newItem)
+{
+	topPtr = nodeAlloc.allocate(move(newItem), topPtr);
+	return true;
+}
+
+template<class ItemType, class Allocator>
+template<class... Args>
+bool LinkedStack<ItemType, Allocator>::emplace(Args&&... args)
+{
+	topPtr = nodeAlloc.emplace(topPtr, forward<Args>(args)...);
+	return true;
+}
+
+template<class ItemType, class Allocator>
+template<class InputIterator>
+bool LinkedStack<ItemType, Allocator>::pushMany(InputIterator first, InputIterator last)
+{
+	for (; first != last; ++first)
+		topPtr = nodeAlloc.emplace(topPtr, *first);
+	return true;
+}
+
+template<class ItemType, class Allocator>
+bool LinkedStack<ItemType, Allocator>::pop()
+{
+	if (!isEmpty())
+	{
+		Node<ItemType>* nodeToDeletePtr = topPtr;
+		topPtr = topPtr->next;
+
+		nodeToDeletePtr->next = nullptr;
+		nodeAlloc.deallocate(nodeToDeletePtr);
+		nodeToDeletePtr = nullptr;
+
+		return true;
+	}
+	return false;
+}
+
+template<class ItemType, class Allocator>
+ItemType LinkedStack<ItemType, Allocator>::peek() const
+{
+	if (isEmpty())
+		throw logic_error("Precondition Violated Exception: peek() called with an empty stack.\n");
+
+	return topPtr->item;
+}
+
+template<class ItemType, class Allocator>
+const LinkedStack<ItemType, Allocator>& LinkedStack<ItemType, Allocator>::operator=(LinkedStack<ItemType, Allocator>&& aStack)
+{
+	if (this != &aStack)
+	{
+		nodeAlloc.deallocateAll(topPtr);
+		topPtr = aStack.topPtr;
+		nodeAlloc = move(aStack.nodeAlloc);
+		aStack.topPtr = nullptr;
+	}
+	return *this;
+}
+
+//=================================================================================================
+// ArrayStack
+//=================================================================================================
+template<class ItemType>
+ArrayStack<ItemType>::ArrayStack() : top(-1), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+}
+
+template<class ItemType>
+template<class InputIterator>
+ArrayStack<ItemType>::ArrayStack(InputIterator first, InputIterator last) : top(-1), maxItems(DEFAULT_CAPACITY)
+{
+	items = allocateItems<ItemType>(maxItems);
+	pushMany(first, last);
+}
+
+template<class ItemType>
+ArrayStack<ItemType>::ArrayStack(const ArrayStack& aStack)
+{
+	top = aStack.top;
+	maxItems = aStack.maxItems;
+	items = allocateItems<ItemType>(maxItems);
+	copyItems(items, aStack.items, top + 1);
+}
+
+template<class ItemType>
+ArrayStack<ItemType>::ArrayStack(ArrayStack&& aStack)
+	: items(aStack.items), top(aStack.top), maxItems(aStack.maxItems)
+{
+	// aStack is left empty with no capacity; its next push() allocates again
+	aStack.items = nullptr;
+	aStack.top = -1;
+	aStack.maxItems = 0;
+}
+
+template<class ItemType>
+ArrayStack<ItemType>::~ArrayStack()
+{
+	destroyItems(items, 0, top + 1);
+	freeItems(items);
+}
+
+template<class ItemType>
+bool ArrayStack<ItemType>::isEmpty() const
+{
+	return (top < 0);
+}
+
+template<class ItemType>
+bool ArrayStack<ItemType>::push(const ItemType& newEntry)
+{
+	return emplace(newEntry);
+}
+
+template<class ItemType>
+bool ArrayStack<ItemType>::push(ItemType&& newEntry)
+{
+	return emplace(move(newEntry));
+}
+
+template<class ItemType>
+template<class... Args>
+bool ArrayStack<ItemType>::emplace(Args&&... args)
+{
+	bool hasRoomToAdd = (top < maxItems - 1);
+	if (hasRoomToAdd)
+	{
+		new (&items[top + 1]) ItemType(forward<Args>(args)...);
+	}
+	else
+	{
+		ItemType newEntry(forward<Args>(args)...); // before growing: args may refer into items
+		reserve((maxItems > 0) ? 2 * maxItems : DEFAULT_CAPACITY);
+		new (&items[top + 1]) ItemType(move(newEntry));
+	}
+	top++;
+
+	return true;
+}
+
+template<class ItemType>
+template<class InputIterator>
+bool ArrayStack<ItemType>::pushMany(InputIterator first, InputIterator last)
+{
+	int count = rangeLength(first, last);
+	if (count > 0 && top + 1 + count > maxItems)
+		reserve(grownCapacity(maxItems, top + 1 + count));
+	for (; first != last; ++first)
+	{
+		if (top == maxItems - 1) // only for single-pass ranges
+			reserve(grownCapacity(maxItems, top + 2));
+		new (&items[top + 1]) ItemType(*first);
+		top++;
+	}
+
+	return true;
+}
+
+template<class ItemType>
+bool ArrayStack<ItemType>::pop()
+{
+	if (!isEmpty())
+	{
+		destroyItems(items, top, top + 1);
+		top--;
+		return true;
+	}
+	return false;
+}
+
+template<class ItemType>
+ItemType ArrayStack<ItemType>::peek() const
+{
+	if (isEmpty())
+		throw logic_error("Precondition Violated Exception: peek() called with an empty stack.\n");
+
+	return items[top];
+}
+
+template<class ItemType>
+void ArrayStack<ItemType>::reserve(int newCapacity)
+{
+	if (newCapacity > maxItems)
+	{
+		items = reallocateItems(items, top + 1, newCapacity);
+		maxItems = newCapacity;
+	}
+}
+
+template<class ItemType>
+void ArrayStack<ItemType>::shrink_to_fit()
+{
+	if (top + 1 < maxItems)
+	{
+		items = reallocateItems(items, top + 1, top + 1);
+		maxItems = top + 1;
+	}
+}
+
+template<class ItemType>
+const ArrayStack<ItemType>& ArrayStack<ItemType>::operator=(ArrayStack<ItemType>&& aStack)
+{
+	if (this != &aStack)
+	{
+		destroyItems(items, 0, top + 1);
+		freeItems(items);
+		items = aStack.items;
+		top = aStack.top;
+		maxItems = aStack.maxItems;
+		aStack.items = nullptr;
+		aStack.top = -1;
+		aStack.maxItems = 0;
+	}
+	return *this;
+}
+#endif // !_STACK_H_
@@ -0,0 +1,24 @@
+// TreapNode.h
+#ifndef _TREAP_NODE_H_
+#define _TREAP_NODE_H_
+#include <utility>
+template<class ItemType>
+struct TreapNode
+{
+	ItemType item; // data portion
+	TreapNode<ItemType>* leftChildPtr;  // pointer to left child
+	TreapNode<ItemType>* rightChildPtr; // pointer to right child
+	TreapNode<ItemType>* parentPtr;     // pointer to parent, nullptr at the root
+	unsigned priority; // random; a parent's is never below its children's
+	int size;          // number of nodes in this subtree
+	template<class... Args>
+	TreapNode(unsigned aPriority, Args&&... args); // builds item in place from args
+};
+
+template<class ItemType>
+template<class... Args>
+TreapNode<ItemType>::TreapNode(unsigned aPriority, Args&&... args)
+	: item(std::forward<Args>(args)...), leftChildPtr(nullptr), rightChildPtr(nullptr), parentPtr(nullptr), priority(aPriority), size(1)
+{
+}
+#endif // !_TREAP_NODE_H_
@@ -0,0 +1,185 @@
+// WorkStealingDeque.h
+#ifndef _WORK_STEALING_DEQUE_H_
+#define _WORK_STEALING_DEQUE_H_
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include "ArrayStorage.h"
+using namespace std;
+
+// Chase-Lev work-stealing deque: the owner thread pushes and pops at the bottom (LIFO, like an
+// ArrayStack) with no compare-and-swap except when a single item is left, and any number of
+// thief threads steal from the top (FIFO, like an ArrayQueue) with one compare-and-swap each.
+// The items sit in a circular array that the owner doubles when it is full, as ArrayQueue does;
+// a thief may still be reading an old array, so old arrays are kept until the deque is destroyed
+// (all of them together are smaller than the current one).
+// A thief reads its item before it knows it has won it, so ItemType must be trivially copyable
+// (a task pointer, an index, ...).
+template<class ItemType>
+class WorkStealingDeque
+{
+private:
+	static const int CACHE_LINE = 64;
+	static const int DEFAULT_CAPACITY = 32;
+	static const int MAX_CAPACITY = 1 << 30; // the biggest power of 2 an int holds
+	struct Ring
+	{
+		long long mask; // capacity - 1
+		atomic<ItemType>* items;
+		Ring* older;    // the array this one replaced
+	};
+
+	alignas(CACHE_LINE) atomic<long long> top;    // next index to steal; only ever goes up
+	alignas(CACHE_LINE) atomic<long long> bottom; // next index to push; written by the owner only
+	atomic<Ring*> ring;
+	char padding[CACHE_LINE - sizeof(atomic<long long>) - sizeof(atomic<Ring*>)];
+	static Ring* makeRing(long long capacity, Ring* older);
+	Ring* grow(Ring* oldRing, long long first, long long last); // doubles; copies items first .. last - 1
+public:
+	explicit WorkStealingDeque(int capacity = DEFAULT_CAPACITY); // rounded up to a power of 2, at most 2^30
+	WorkStealingDeque(const WorkStealingDeque<ItemType>& aDeque) = delete;
+	~WorkStealingDeque();
+	bool isEmpty() const;         // only a hint while other threads are using the deque
+	int getNumberOfItems() const; // only a hint while other threads are using the deque
+	// owner thread only
+	bool push(const ItemType& newEntry); // false if the deque holds 2^30 items and cannot grow
+	bool pop(ItemType& bottomEntry); // the newest item; false if the deque is empty
+	// any thread
+	bool steal(ItemType& topEntry); // the oldest item; false if empty or another thread got it first
+	const WorkStealingDeque<ItemType>& operator=(const WorkStealingDeque<ItemType>& aDeque) = delete;
+};
+
+//=================================================================================================
+// WorkStealingDeque
+//=================================================================================================
+template<class ItemType>
+WorkStealingDeque<ItemType>::WorkStealingDeque(int capacity) : top(0), bottom(0)
+{
+	static_assert(is_trivially_copyable<ItemType>::value, "WorkStealingDeque needs a trivially copyable ItemType");
+	if (capacity > MAX_CAPACITY)
+		throw logic_error("Precondition Violated Exception: WorkStealingDeque() called with a capacity over 2^30.\n");
+
+	long long roundedCapacity = 1;
+	while(roundedCapacity < capacity)
+		roundedCapacity *= 2;
+	ring.store(makeRing(roundedCapacity, nullptr), memory_order_relaxed);
+}
+
+template<class ItemType>
+WorkStealingDeque<ItemType>::~WorkStealingDeque()
+{
+	Ring* ringPtr = ring.load(memory_order_relaxed);
+	while(ringPtr != nullptr)
+	{
+		Ring* ringToDeletePtr = ringPtr;
+		ringPtr = ringPtr->older;
+		freeItems(ringToDeletePtr->items);
+		delete ringToDeletePtr;
+	}
+}
+
+template<class ItemType>
+bool WorkStealingDeque<ItemType>::isEmpty() const
+{
+	return (bottom.load(memory_order_acquire) <= top.load(memory_order_acquire));
+}
+
+template<class ItemType>
+int WorkStealingDeque<ItemType>::getNumberOfItems() const
+{
+	long long count = bottom.load(memory_order_acquire) - top.load(memory_order_acquire);
+	return (count > 0) ? static_cast<int>(count) : 0;
+}
+
+template<class ItemType>
+bool WorkStealingDeque<ItemType>::push(const ItemType& newEntry)
+{
+	long long last = bottom.load(memory_order_relaxed);
+	long long first = top.load(memory_order_acquire);
+	Ring* ringPtr = ring.load(memory_order_relaxed);
+	if(last - first > ringPtr->mask) // full
+	{
+		if(ringPtr->mask + 1 == MAX_CAPACITY) // doubling would not fit in an int
+			return false;
+		ringPtr = grow(ringPtr, first, last);
+	}
+
+	ringPtr->items[last & ringPtr->mask].store(newEntry, memory_order_relaxed);
+	bottom.store(last + 1, memory_order_release); // a thief that sees the new bottom sees the item
+	return true;
+}
+
+template<class ItemType>
+bool WorkStealingDeque<ItemType>::pop(ItemType& bottomEntry)
+{
+	long long last = bottom.load(memory_order_relaxed) - 1;
+	Ring* ringPtr = ring.load(memory_order_relaxed);
+	// take the bottom item before looking at top: a thief that comes later will not reach it,
+	// and one that came earlier shows up in top (seq_cst orders the store before the load)
+	bottom.store(last, memory_order_seq_cst);
+	long long first = top.load(memory_order_seq_cst);
+	if(first > last) // it was empty
+	{
+		bottom.store(last + 1, memory_order_relaxed);
+		return false;
+	}
+
+	ItemType entry = ringPtr->items[last & ringPtr->mask].load(memory_order_relaxed);
+	if(first < last) // more than one item: no thief can reach this one
+	{
+		bottomEntry = entry;
+		return true;
+	}
+
+	// the last item: race the thieves for it on top
+	bool won = top.compare_exchange_strong(first, first + 1, memory_order_seq_cst, memory_order_relaxed);
+	bottom.store(last + 1, memory_order_relaxed);
+	if(won) // bottomEntry is left alone when a thief got the item
+		bottomEntry = entry;
+	return won;
+}
+
+template<class ItemType>
+bool WorkStealingDeque<ItemType>::steal(ItemType& topEntry)
+{
+	long long first = top.load(memory_order_seq_cst);
+	long long last = bottom.load(memory_order_seq_cst);
+	if(first >= last)
+		return false;
+
+	Ring* ringPtr = ring.load(memory_order_acquire);
+	ItemType entry = ringPtr->items[first & ringPtr->mask].load(memory_order_relaxed);
+	if(!top.compare_exchange_strong(first, first + 1, memory_order_seq_cst, memory_order_relaxed))
+		return false; // the owner or another thief took it
+	topEntry = entry;
+	return true;
+}
+
+// private member function of WorkStealingDeque
+template<class ItemType>
+typename WorkStealingDeque<ItemType>::Ring* WorkStealingDeque<ItemType>::makeRing(long long capacity, Ring* older)
+{
+	Ring* ringPtr = new Ring;
+	ringPtr->mask = capacity - 1;
+	ringPtr->items = allocateItems<atomic<ItemType> >(static_cast<int>(capacity));
+	for(long long index = 0; index < capacity; index++)
+		new (&ringPtr->items[index]) atomic<ItemType>();
+	ringPtr->older = older;
+	return ringPtr;
+}
+
+// private member function of WorkStealingDeque
+// Only the owner grows the deque; thieves keep reading the old array until they see the new one,
+// and the items they can still steal are the same in both.
+template<class ItemType>
+typename WorkStealingDeque<ItemType>::Ring* WorkStealingDeque<ItemType>::grow(Ring* oldRing, long long first, long long last)
+{
+	Ring* newRing = makeRing(2 * (oldRing->mask + 1), oldRing);
+	for(long long index = first; index < last; index++)
+		newRing->items[index & newRing->mask].store(oldRing->items[index & oldRing->mask].load(memory_order_relaxed), memory_order_relaxed);
+	ring.store(newRing, memory_order_release);
+	return newRing;
+}
+#endif // !_WORK_STEALING_DEQUE_H_
@@ -0,0 +1,90 @@
+// ConcurrentLinkedQueueStress.cpp
+// Stress test of ConcurrentLinkedQueue, meant to run under ThreadSanitizer:
+//   g++ -std=c++17 -O1 -g -fsanitize=thread -pthread -I.. ConcurrentLinkedQueueStress.cpp -o ConcurrentLinkedQueueStress
+//   ./ConcurrentLinkedQueueStress [producers] [consumers]
+// Producers enqueue numbered strings while consumers dequeue them, so enqueues race on backPtr,
+// dequeues race on frontPtr, and dequeued dummies are retired while other threads may still
+// hold them through their hazard pointers.
+// Each value must come out exactly once, and every consumer must see each producer's values in
+// the order they went in; TSan reports any race on a node or on the string handed over.
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../ConcurrentQueue.h"
+using namespace std;
+
+static const int ENQUEUES_PER_PRODUCER = 100000;
+
+bool stress(int producerCount, int consumerCount)
+{
+	ConcurrentLinkedQueue<string> aQueue;
+	int totalCount = producerCount * ENQUEUES_PER_PRODUCER;
+	vector<atomic<int> > timesDequeued(totalCount);
+	for (atomic<int>& times : timesDequeued)
+		times.store(0);
+	atomic<int> dequeuedCount(0);
+	atomic<int> outOfOrderCount(0);
+
+	vector<thread> threads;
+	for (int p = 0; p < producerCount; p++)
+	{
+		threads.emplace_back([&aQueue, p]()
+		{
+			for (int i = 0; i < ENQUEUES_PER_PRODUCER; i++)
+				aQueue.enqueue(to_string(p * ENQUEUES_PER_PRODUCER + i));
+		});
+	}
+	for (int c = 0; c < consumerCount; c++)
+	{
+		threads.emplace_back([&aQueue, &timesDequeued, &dequeuedCount, &outOfOrderCount, producerCount, totalCount]()
+		{
+			vector<int> lastSeen(producerCount, -1); // per producer, the last value this consumer took
+			string frontEntry;
+			while (dequeuedCount.load() < totalCount)
+			{
+				if (!aQueue.try_dequeue(frontEntry))
+					continue;
+				int value = stoi(frontEntry);
+				int producer = value / ENQUEUES_PER_PRODUCER;
+				if (value <= lastSeen[producer])
+					outOfOrderCount++;
+				lastSeen[producer] = value;
+				timesDequeued[value]++;
+				dequeuedCount++;
+			}
+		});
+	}
+	for (thread& aThread : threads)
+		aThread.join();
+
+	bool passed = aQueue.isEmpty();
+	if (!passed)
+		cout << "queue not empty after every value was dequeued" << endl;
+	if (outOfOrderCount.load() != 0)
+	{
+		cout << outOfOrderCount.load() << " values dequeued out of their producer's order" << endl;
+		passed = false;
+	}
+	for (int value = 0; value < totalCount; value++)
+	{
+		if (timesDequeued[value].load() != 1)
+		{
+			cout << "value " << value << " dequeued " << timesDequeued[value].load() << " times" << endl;
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+int main(int argc, char* argv[])
+{
+	int producerCount = (argc > 1) ? atoi(argv[1]) : 4;
+	int consumerCount = (argc > 2) ? atoi(argv[2]) : 4;
+	bool passed = stress(producerCount, consumerCount) && stress(1, consumerCount)
+		&& stress(producerCount, 1);
+	cout << (passed ? "passed" : "FAILED") << endl;
+	return passed ? 0 : 1;
+}
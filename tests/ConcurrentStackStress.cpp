@@ -0,0 +1,73 @@
+// ConcurrentStackStress.cpp
+// Stress test of ConcurrentStack, meant to run under ThreadSanitizer:
+//   g++ -std=c++17 -O1 -g -fsanitize=thread -pthread -I.. ConcurrentStackStress.cpp -o ConcurrentStackStress
+//   ./ConcurrentStackStress [threads]
+// Every thread pushes its own numbered strings and pops in bursts, so pushes and pops keep
+// colliding on topPtr and, with elimination slots, meet in the elimination array.
+// Each value must come out exactly once; TSan reports any race on a node or on the string
+// handed over through a slot.
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../ConcurrentStack.h"
+using namespace std;
+
+static const int PUSHES_PER_THREAD = 50000;
+static const int BURST = 8; // pushes, then as many pops
+
+template<int ELIMINATION_SLOTS>
+bool stress(int threadCount)
+{
+	ConcurrentStack<string, ELIMINATION_SLOTS> aStack;
+	int totalCount = threadCount * PUSHES_PER_THREAD;
+	vector<atomic<int> > timesPopped(totalCount);
+	for (atomic<int>& times : timesPopped)
+		times.store(0);
+
+	vector<thread> threads;
+	for (int t = 0; t < threadCount; t++)
+	{
+		threads.emplace_back([&aStack, &timesPopped, t]()
+		{
+			string topEntry;
+			for (int i = 0; i < PUSHES_PER_THREAD; i += BURST)
+			{
+				for (int j = i; j < i + BURST && j < PUSHES_PER_THREAD; j++)
+					aStack.push(to_string(t * PUSHES_PER_THREAD + j));
+				for (int j = 0; j < BURST; j++)
+				{
+					if (aStack.try_pop(topEntry))
+						timesPopped[stoi(topEntry)]++;
+				}
+			}
+		});
+	}
+	for (thread& aThread : threads)
+		aThread.join();
+
+	string topEntry;
+	while (aStack.try_pop(topEntry)) // what the last bursts left behind
+		timesPopped[stoi(topEntry)]++;
+
+	bool passed = true;
+	for (int value = 0; value < totalCount; value++)
+	{
+		if (timesPopped[value].load() != 1)
+		{
+			cout << "value " << value << " popped " << timesPopped[value].load() << " times" << endl;
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+int main(int argc, char* argv[])
+{
+	int threadCount = (argc > 1) ? atoi(argv[1]) : 8;
+	bool passed = stress<0>(threadCount) && stress<1>(threadCount) && stress<4>(threadCount);
+	cout << (passed ? "passed" : "FAILED") << endl;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// CountingBagRandom.cpp
+// Random adds and removes on a CountingBag, checked against a map after every step:
+//   g++ -std=c++17 -O1 -g -fsanitize=address,undefined -I.. CountingBagRandom.cpp -o CountingBagRandom
+//   ./CountingBagRandom
+// The items hold strings, so they are not trivially copyable, and they know whether they are
+// live, moved from or destroyed: the bag must never compare against one that is not live.
+// A table slot left pointing at a moved-from or destroyed item shows up that way, or as a
+// wrong count.
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include "../Bag.h"
+using namespace std;
+
+static const int STEPS = 50000;
+static const int KEYS = 64; // few enough that removes often drop the last copy
+
+static bool badCompare = false;
+
+class TrackedItem
+{
+private:
+	enum State { LIVE = 0x11ee, MOVED_FROM = 0x3073d, DESTROYED = 0xdead };
+	string value;
+	State state;
+public:
+	TrackedItem(const string& aValue) : value(aValue), state(LIVE) {}
+	TrackedItem(const TrackedItem& anItem) : value(anItem.value), state(LIVE) {}
+	TrackedItem(TrackedItem&& anItem) : value(move(anItem.value)), state(LIVE) { anItem.state = MOVED_FROM; }
+	~TrackedItem() { state = DESTROYED; }
+	TrackedItem& operator=(const TrackedItem& anItem) { value = anItem.value; state = LIVE; return *this; }
+	TrackedItem& operator=(TrackedItem&& anItem)
+	{
+		value = move(anItem.value);
+		state = LIVE;
+		anItem.state = MOVED_FROM;
+		return *this;
+	}
+	bool operator==(const TrackedItem& anItem) const
+	{
+		if (state != LIVE || anItem.state != LIVE)
+			badCompare = true;
+		return value == anItem.value;
+	}
+	bool operator<(const TrackedItem& anItem) const { return value < anItem.value; }
+	bool operator>(const TrackedItem& anItem) const { return value > anItem.value; }
+	const string& getValue() const { return value; }
+};
+
+// for CountingBag::print()
+ostream& operator<<(ostream& out, const TrackedItem& anItem)
+{
+	return out << anItem.getValue();
+}
+
+struct TrackedHash
+{
+	size_t operator()(const TrackedItem& anItem) const { return hash<string>()(anItem.getValue()); }
+};
+
+typedef CountingBag<TrackedItem, TrackedHash> TestBag;
+
+bool sameContents(const TestBag& aBag, const map<string, int>& expected, bool walkItems)
+{
+	int itemCount = 0;
+	int distinctCount = 0;
+	for (const pair<const string, int>& entry : expected)
+	{
+		if (aBag.getFrequencyOf(TrackedItem(entry.first)) != entry.second)
+			return false;
+		if (entry.second > 0)
+			distinctCount++;
+		itemCount += entry.second;
+	}
+	if (!walkItems)
+		return (aBag.getCurrentSize() == itemCount) && (aBag.getDistinctCount() == distinctCount);
+	int iteratedCount = 0;
+	for (TestBag::const_iterator it = aBag.begin(); it != aBag.end(); ++it)
+	{
+		map<string, int>::const_iterator found = expected.find(it->getValue());
+		if (found == expected.end() || found->second == 0)
+			return false;
+		iteratedCount++;
+	}
+	return (aBag.getCurrentSize() == itemCount) && (aBag.getDistinctCount() == distinctCount)
+		&& (iteratedCount == itemCount);
+}
+
+int main()
+{
+	srand(1);
+	TestBag aBag;
+	map<string, int> expected;
+	for (int step = 0; step < STEPS; step++)
+	{
+		// long enough that the strings live on the heap
+		string key = "a key long enough to be allocated " + to_string(rand() % KEYS);
+		int n = 1 + rand() % 3;
+		if (rand() % 2 == 0)
+		{
+			aBag.add(TrackedItem(key), n);
+			expected[key] += n;
+		}
+		else if (aBag.remove(TrackedItem(key), n) != (expected[key] >= n))
+		{
+			cout << "FAILED: remove() of " << n << " at step " << step << endl;
+			return 1;
+		}
+		else if (expected[key] >= n)
+			expected[key] -= n;
+
+		if (badCompare || !sameContents(aBag, expected, step % 100 == 0))
+		{
+			cout << "FAILED: " << (badCompare ? "compared a dead item" : "contents differ")
+			     << " at step " << step << endl;
+			return 1;
+		}
+	}
+	cout << "ok" << endl;
+	return 0;
+}
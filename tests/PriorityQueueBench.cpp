@@ -0,0 +1,176 @@
+// PriorityQueueBench.cpp
+// Runs every PriorityQueueInterface backend on the same operation traces and prints ns/op:
+//   g++ -std=c++17 -O2 -I.. PriorityQueueBench.cpp -o PriorityQueueBench
+//   ./PriorityQueueBench [N ...]   (default: 1000 1000000)
+// Keys are unsigned long long, smallest first. The traces are
+//   add N, then remove N;
+//   hold: N entries, then 2N times remove the smallest and add it back plus a random step,
+//         so the keys only go up, as in an event simulation;
+//   decrease-key (backends with handles only): add N, lower N random entries, remove N.
+// Every backend must remove the same keys, so the checksum of the removed keys is printed too.
+// SL_PriorityQueue is O(N) per add and only runs up to N = 10000.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+#include "../Heap_PriorityQueue.h"
+#include "../SL_PriorityQueue.h"
+using namespace std;
+
+typedef unsigned long long KeyType;
+static const long long REMOVE = -1; // trace entry for remove(); any other entry is a key to add
+static const int RUNS = 3;          // each trace runs this many times; the best time is kept
+
+typedef vector<long long> Trace;
+
+struct DecreaseStep
+{
+	int index;      // which entry, in the order they were added
+	KeyType newKey; // below its current key
+};
+
+Trace addRemoveTrace(int n, mt19937_64& rng)
+{
+	Trace trace;
+	for (int i = 0; i < n; i++)
+		trace.push_back(rng() % 1000000000);
+	trace.insert(trace.end(), n, REMOVE);
+	return trace;
+}
+
+Trace holdTrace(int n, mt19937_64& rng)
+{
+	Trace trace;
+	priority_queue<long long, vector<long long>, greater<long long> > simulated;
+	for (int i = 0; i < n; i++)
+	{
+		long long key = rng() % 1000000;
+		trace.push_back(key);
+		simulated.push(key);
+	}
+	for (int i = 0; i < 2 * n; i++)
+	{
+		long long key = simulated.top() + rng() % 1000000;
+		simulated.pop();
+		trace.push_back(REMOVE);
+		trace.push_back(key);
+		simulated.push(key);
+	}
+	return trace;
+}
+
+template<class PriorityQueue>
+double runTrace(const Trace& trace, KeyType& checksum)
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	PriorityQueue aQueue;
+	for (long long step : trace)
+	{
+		if (step == REMOVE)
+		{
+			checksum += aQueue.peek();
+			aQueue.remove();
+		}
+		else
+			aQueue.add(static_cast<KeyType>(step));
+	}
+	chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+	return elapsed.count() / trace.size();
+}
+
+template<class PriorityQueue>
+double runDecreaseTrace(const vector<KeyType>& keys, const vector<DecreaseStep>& steps, KeyType& checksum)
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	PriorityQueue aQueue;
+	vector<typename PriorityQueue::Handle> handles;
+	handles.reserve(keys.size());
+	for (KeyType key : keys)
+		handles.push_back(aQueue.insert(key));
+	for (const DecreaseStep& step : steps)
+		aQueue.updatePriority(handles[step.index], step.newKey);
+	while (!aQueue.isEmpty())
+	{
+		checksum += aQueue.peek();
+		aQueue.remove();
+	}
+	chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+	return elapsed.count() / (2 * keys.size() + steps.size());
+}
+
+template<class PriorityQueue>
+void report(const char* name, const Trace& trace)
+{
+	KeyType checksum = 0;
+	double best = 0;
+	for (int run = 0; run < RUNS; run++)
+	{
+		double nsPerOp = runTrace<PriorityQueue>(trace, checksum);
+		if (run == 0 || nsPerOp < best)
+			best = nsPerOp;
+	}
+	printf("  %-26s %8.1f ns/op   checksum %llu\n", name, best, checksum / RUNS);
+}
+
+template<class PriorityQueue>
+void reportDecrease(const char* name, const vector<KeyType>& keys, const vector<DecreaseStep>& steps)
+{
+	KeyType checksum = 0;
+	double best = 0;
+	for (int run = 0; run < RUNS; run++)
+	{
+		double nsPerOp = runDecreaseTrace<PriorityQueue>(keys, steps, checksum);
+		if (run == 0 || nsPerOp < best)
+			best = nsPerOp;
+	}
+	printf("  %-26s %8.1f ns/op   checksum %llu\n", name, best, checksum / RUNS);
+}
+
+void reportAll(int n, const char* traceName, const Trace& trace)
+{
+	printf("N = %d, %s\n", n, traceName);
+	// the heaps put the largest first under their Compare, so greater gives the smallest;
+	// SL_PriorityQueue takes the front of its sorted list, so the default less does
+	report<Heap_PriorityQueue<KeyType, greater<KeyType> > >("Heap_PriorityQueue", trace);
+	report<Heap_PriorityQueue<KeyType, greater<KeyType>, 4> >("Heap_PriorityQueue D=4", trace);
+	report<IndexedHeap_PriorityQueue<KeyType, greater<KeyType> > >("IndexedHeap_PriorityQueue", trace);
+	report<PairingHeap_PriorityQueue<KeyType, greater<KeyType> > >("PairingHeap_PriorityQueue", trace);
+	report<RadixHeap_PriorityQueue<KeyType> >("RadixHeap_PriorityQueue", trace);
+	if (n <= 10000)
+		report<SL_PriorityQueue<KeyType> >("SL_PriorityQueue", trace);
+}
+
+int main(int argc, char* argv[])
+{
+	vector<int> sizes;
+	for (int i = 1; i < argc; i++)
+		sizes.push_back(atoi(argv[i]));
+	if (sizes.empty())
+		sizes = { 1000, 1000000 };
+
+	mt19937_64 rng(7);
+	for (int n : sizes)
+	{
+		reportAll(n, "add N, remove N", addRemoveTrace(n, rng));
+		reportAll(n, "hold", holdTrace(n, rng));
+
+		vector<KeyType> keys;
+		for (int i = 0; i < n; i++)
+			keys.push_back(1000000000 + rng() % 1000000000);
+		vector<KeyType> currentKeys(keys);
+		vector<DecreaseStep> steps;
+		for (int i = 0; i < n; i++)
+		{
+			int index = static_cast<int>(rng() % n);
+			currentKeys[index] -= 1 + rng() % (currentKeys[index] / 2);
+			steps.push_back({ index, currentKeys[index] });
+		}
+		printf("N = %d, decrease-key\n", n);
+		reportDecrease<IndexedHeap_PriorityQueue<KeyType, greater<KeyType> > >("IndexedHeap_PriorityQueue", keys, steps);
+		reportDecrease<PairingHeap_PriorityQueue<KeyType, greater<KeyType> > >("PairingHeap_PriorityQueue", keys, steps);
+	}
+	return 0;
+}
@@ -0,0 +1,86 @@
+// UnrolledListInsertRange.cpp
+// Checks UnrolledList::insertRange against a vector, and checks that it keeps every chunk but
+// the last at least half full:
+//   g++ -std=c++17 -O1 -g -fsanitize=address,undefined -I.. UnrolledListInsertRange.cpp -o UnrolledListInsertRange
+//   ./UnrolledListInsertRange
+// Ranges of every length up to a few chunks go at the front, at the end, at a chunk boundary
+// and into the middle of a chunk, so most of them are not a multiple of the chunk size.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// every standard header that List.h pulls in is included above, so the macro only reaches
+// the repo's own headers; their include guards keep it out of any later inclusion
+#define private public // to walk the chunks
+#include "../List.h"
+#undef private
+using namespace std;
+
+static const int CHUNK_SIZE = 8;
+typedef UnrolledList<string, CHUNK_SIZE> TestList;
+
+bool chunksHalfFull(const TestList& aList)
+{
+	int itemCount = 0;
+	int chunkCount = 0;
+	for(TestList::Chunk* chunkPtr = aList.headPtr; chunkPtr != nullptr; chunkPtr = chunkPtr->next)
+	{
+		if(chunkPtr->count == 0 || (chunkPtr->next != nullptr && chunkPtr->count < CHUNK_SIZE / 2))
+			return false;
+		itemCount += chunkPtr->count;
+		chunkCount++;
+	}
+	return (itemCount == aList.itemCount) && (chunkCount == aList.chunkCount);
+}
+
+bool sameItems(const TestList& aList, const vector<string>& expected)
+{
+	if(aList.getLength() != (int)expected.size())
+		return false;
+	int i = 0;
+	for(TestList::const_iterator it = aList.begin(); it != aList.end(); ++it, ++i)
+		if(*it != expected[i])
+			return false;
+	return true;
+}
+
+int main()
+{
+	int failures = 0;
+	for(int oldLength = 0; oldLength <= 3 * CHUNK_SIZE; oldLength++)
+	{
+		for(int rangeLength = 1; rangeLength <= 3 * CHUNK_SIZE + 1; rangeLength++)
+		{
+			for(int position = 1; position <= oldLength + 1; position++)
+			{
+				vector<string> expected;
+				for(int i = 0; i < oldLength; i++)
+					expected.push_back("old " + to_string(i));
+				TestList aList(expected.begin(), expected.end());
+				vector<string> range;
+				for(int i = 0; i < rangeLength; i++)
+					range.push_back("new " + to_string(i));
+
+				aList.insertRange(position, range.begin(), range.end());
+				expected.insert(expected.begin() + (position - 1), range.begin(), range.end());
+				if(!sameItems(aList, expected) || !chunksHalfFull(aList))
+				{
+					cout << "failed: " << rangeLength << " items at " << position
+					     << " of a list of " << oldLength << endl;
+					failures++;
+				}
+			}
+		}
+	}
+	cout << (failures == 0 ? "ok" : "FAILED") << endl;
+	return failures == 0 ? 0 : 1;
+}